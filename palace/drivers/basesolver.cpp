@@ -12,15 +12,18 @@
 #include "fem/errorindicator.hpp"
 #include "fem/fespace.hpp"
 #include "fem/mesh.hpp"
+#include "linalg/feast.hpp"
 #include "linalg/ksp.hpp"
 #include "models/domainpostoperator.hpp"
 #include "models/postoperator.hpp"
 #include "models/surfacepostoperator.hpp"
+#include "models/timeoperator.hpp"
 #include "utils/communication.hpp"
 #include "utils/dorfler.hpp"
 #include "utils/filesystem.hpp"
 #include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
+#include "utils/profiler.hpp"
 #include "utils/timer.hpp"
 
 namespace palace
@@ -293,6 +296,24 @@ void BaseSolver::SaveMetadata(const SolverType &ksp) const
     json meta = LoadMetadata(post_dir);
     meta["LinearSolver"]["TotalSolves"] = ksp.NumTotalMult();
     meta["LinearSolver"]["TotalIts"] = ksp.NumTotalMultIterations();
+    meta["LinearSolver"]["TotalPCSetups"] = ksp.NumTotalPreconditionerSetup();
+    WriteMetadata(post_dir, meta);
+  }
+}
+
+void BaseSolver::SaveMetadata(const SweepStepData &data) const
+{
+  if (post_dir.length() == 0)
+  {
+    return;
+  }
+  if (root)
+  {
+    json meta = LoadMetadata(post_dir);
+    meta["LinearSolver"]["StepIts"] = data.its;
+    meta["LinearSolver"]["StepPCReused"] = data.pc_reused;
+    meta["LinearSolver"]["StepSetupTime"] = data.setup_time;
+    meta["LinearSolver"]["StepSolveTime"] = data.solve_time;
     WriteMetadata(post_dir, meta);
   }
 }
@@ -303,9 +324,16 @@ void BaseSolver::SaveMetadata(const Timer &timer) const
   {
     return;
   }
+  MPI_Comm comm = Mpi::World();
+  json profile = Profiler::Summary(comm);
+  if (Profiler::Trace())
+  {
+    Profiler::WriteTrace(comm, post_dir + "palace-trace.json");
+  }
   if (root)
   {
     json meta = LoadMetadata(post_dir);
+    meta["Profile"] = std::move(profile);
     for (int i = Timer::INIT; i < Timer::NUM_TIMINGS; i++)
     {
       auto key = Timer::descriptions[i];
@@ -317,6 +345,65 @@ void BaseSolver::SaveMetadata(const Timer &timer) const
   }
 }
 
+void BaseSolver::MergeMetadata(const std::vector<std::string> &sub_dirs,
+                               const std::string &key) const
+{
+  // The problem size is the same for all subdirectories, while the linear solver
+  // statistics are summed. Integer counts are summed as integers and other numeric values
+  // (for example timings) as floating point. Arrays of per-step statistics are not merged,
+  // since the subdirectories may each cover a strided subset of the steps, and remain
+  // available in the metadata for each subdirectory. Other entries are taken from the
+  // first subdirectory which has them.
+  if (post_dir.length() == 0 || !root)
+  {
+    return;
+  }
+  json meta = LoadMetadata(post_dir);
+  meta[key] = json::array();
+  for (const auto &sub_dir : sub_dirs)
+  {
+    json sub_meta = LoadMetadata(sub_dir);
+    if (sub_meta.contains("Problem"))
+    {
+      for (const auto *name :
+           {"MeshElements", "DegreesOfFreedom", "MultigridDegreesOfFreedom"})
+      {
+        if (sub_meta["Problem"].contains(name))
+        {
+          meta["Problem"][name] = sub_meta["Problem"][name];
+        }
+      }
+    }
+    if (sub_meta.contains("LinearSolver"))
+    {
+      auto &solver_meta = meta["LinearSolver"];
+      for (const auto &[name, value] : sub_meta["LinearSolver"].items())
+      {
+        if (value.is_array())
+        {
+          continue;
+        }
+        if (!solver_meta.contains(name))
+        {
+          solver_meta[name] = value;
+        }
+        else if (value.is_number_integer() && solver_meta[name].is_number_integer())
+        {
+          solver_meta[name] =
+              solver_meta[name].get<long long int>() + value.get<long long int>();
+        }
+        else if (value.is_number() && solver_meta[name].is_number())
+        {
+          solver_meta[name] = solver_meta[name].get<double>() + value.get<double>();
+        }
+
+      }
+    }
+    meta[key].push_back(std::move(sub_meta));
+  }
+  WriteMetadata(post_dir, meta);
+}
+
 namespace
 {
 
@@ -784,5 +871,9 @@ void BaseSolver::PostprocessErrorIndicator(const PostOperator &postop,
 
 template void BaseSolver::SaveMetadata<KspSolver>(const KspSolver &) const;
 template void BaseSolver::SaveMetadata<ComplexKspSolver>(const ComplexKspSolver &) const;
+template void BaseSolver::SaveMetadata<feast::FeastEigenvalueSolver>(
+    const feast::FeastEigenvalueSolver &) const;
+template void BaseSolver::SaveMetadata<TimeOperator::LinearSolverStats>(
+    const TimeOperator::LinearSolverStats &) const;
 
 }  // namespace palace
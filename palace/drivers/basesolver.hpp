@@ -88,11 +88,28 @@ public:
   // Dispatches to the Solve method for the driver specific calculations.
   void SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mesh) const;
 
+  // Linear solver statistics for each step of a parameter sweep: the number of linear
+  // solver iterations, whether the preconditioner was reused from a previous step, and
+  // the wall time (s) for the operator and preconditioner setup and for the solve.
+  struct SweepStepData
+  {
+    std::vector<int> its;
+    std::vector<bool> pc_reused;
+    std::vector<double> setup_time, solve_time;
+  };
+
   // These methods write different simulation metadata to a JSON file in post_dir.
   void SaveMetadata(const FiniteElementSpaceHierarchy &fespaces) const;
   template <typename SolverType>
   void SaveMetadata(const SolverType &ksp) const;
   void SaveMetadata(const Timer &timer) const;
+  void SaveMetadata(const SweepStepData &data) const;
+
+  // Merge the metadata written by independent solvers to the given subdirectories of
+  // post_dir into its metadata file. The full metadata for each is stored in an array under
+  // the given key.
+  void MergeMetadata(const std::vector<std::string> &sub_dirs,
+                     const std::string &key) const;
 };
 
 }  // namespace palace
@@ -3,7 +3,12 @@
 
 #include "drivensolver.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
 #include <mfem.hpp>
 #include "fem/errorindicator.hpp"
 #include "fem/mesh.hpp"
@@ -18,6 +23,8 @@
 #include "models/surfacecurrentoperator.hpp"
 #include "models/waveportoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
 #include "utils/prettyprint.hpp"
 #include "utils/timer.hpp"
@@ -27,9 +34,189 @@ namespace palace
 
 using namespace std::complex_literals;
 
+namespace
+{
+
+auto GetSMatrixExcitations(const SpaceOperator &spaceop)
+{
+  // Collect the indices of all excited lumped or wave ports, each of which defines a column
+  // of the scattering matrix. The returned flag indicates whether the excitations are
+  // lumped (true) or wave (false) ports.
+  std::vector<int> lumped_idx, wave_idx;
+  for (const auto &[idx, data] : spaceop.GetLumpedPortOp())
+  {
+    if (data.excitation)
+    {
+      lumped_idx.push_back(idx);
+    }
+  }
+  for (const auto &[idx, data] : spaceop.GetWavePortOp())
+  {
+    if (data.excitation)
+    {
+      wave_idx.push_back(idx);
+    }
+  }
+  MFEM_VERIFY(spaceop.GetSurfaceCurrentOp().Size() == 0,
+              "Full S-matrix computation is not supported with surface current "
+              "excitations!");
+  MFEM_VERIFY(lumped_idx.empty() || wave_idx.empty(),
+              "Full S-matrix computation does not support simultaneous lumped and wave port "
+              "excitations!");
+  MFEM_VERIFY(!lumped_idx.empty() || !wave_idx.empty(),
+              "Full S-matrix computation requires at least one excited lumped or wave port!");
+  const bool src_lumped_port = !lumped_idx.empty();
+  return std::make_pair(src_lumped_port ? lumped_idx : wave_idx, src_lumped_port);
+}
+
+int GetNumGroupSteps(int nstep, int ngroups, int g)
+{
+  // Number of steps out of nstep computed by group g when strided across ngroups.
+  return (nstep - g + ngroups - 1) / ngroups;
+}
+
+void MergeFrequencyGroupOutputs(const std::vector<std::string> &group_dirs,
+                                const std::string &post_dir, int nstep, bool append)
+{
+  // Interleave the rows of each CSV file written by the frequency groups into a single
+  // file in the top-level output directory, ordered by frequency. Group g computes global
+  // steps g, g + K, g + 2K, ... so row i of the merged file is row i / K of group i % K.
+  // When restarting the sweep, the rows are appended to the existing files (without the
+  // header), like for the outputs of a single solver. Error indicators are not merged since
+  // they are not a per-frequency quantity.
+  namespace fs = std::filesystem;
+  const int ngroups = static_cast<int>(group_dirs.size());
+  for (const auto &entry : fs::directory_iterator(group_dirs[0]))
+  {
+    const auto name = entry.path().filename().string();
+    if (entry.path().extension() != ".csv" || name == "error-indicators.csv")
+    {
+      continue;
+    }
+    std::string header;
+    std::vector<std::vector<std::string>> rows(ngroups);
+    bool valid = true;
+    for (int g = 0; g < ngroups; g++)
+    {
+      std::ifstream fi(group_dirs[g] + name);
+      std::string line;
+      if (!fi.is_open() || !std::getline(fi, line))
+      {
+        valid = false;
+        break;
+      }
+      if (g == 0)
+      {
+        header = line;
+      }
+      while (std::getline(fi, line))
+      {
+        rows[g].push_back(line);
+      }
+    }
+    for (int g = 0; valid && g < ngroups; g++)
+    {
+      valid = (static_cast<int>(rows[g].size()) == GetNumGroupSteps(nstep, ngroups, g));
+    }
+    if (!valid)
+    {
+      Mpi::Warning("Unable to merge frequency group outputs for {}, leaving per-group "
+                   "files in place!\n",
+                   name);
+      continue;
+    }
+    std::ofstream fo(post_dir + name, append ? std::ios::app : std::ios::trunc);
+    if (!append)
+    {
+      fo << header << '\n';
+    }
+    for (int i = 0; i < nstep; i++)
+    {
+      fo << rows[i % ngroups][i / ngroups] << '\n';
+    }
+  }
+}
+
+}  // namespace
+
+std::pair<ErrorIndicator, long long int>
+DrivenSolver::SolveFrequencyGroups(const std::vector<std::unique_ptr<Mesh>> &mesh) const
+{
+  // Split the processes into groups which each solve a strided subset of the frequency
+  // steps for a uniform sweep on a copy of the mesh, independently of the other groups.
+  MPI_Comm comm = mesh.back()->GetComm();
+  const auto &driven = iodata.solver.driven;
+  MFEM_VERIFY(driven.adaptive_tol <= 0.0,
+              "Parallel-in-frequency sweep is not supported for adaptive frequency sweep!");
+  MFEM_VERIFY(iodata.model.refinement.max_it == 0,
+              "Parallel-in-frequency sweep is not supported with adaptive mesh "
+              "refinement!");
+  if (mesh.size() > 1)
+  {
+    Mpi::Warning("Parallel-in-frequency sweep only uses the finest mesh of the sequence "
+                 "of a priori refinements!\n");
+  }
+  const int nstep = GetNumSteps(driven.min_f, driven.max_f, driven.delta_f);
+  const int step0 = (driven.rst > 0) ? driven.rst - 1 : 0;
+  const int ngroups =
+      std::max(std::min({driven.freq_groups, Mpi::Size(comm), nstep - step0}), 1);
+  const int color = Mpi::Rank(comm) * ngroups / Mpi::Size(comm);
+  MPI_Comm group_comm;
+  MPI_Comm_split(comm, color, Mpi::Rank(comm), &group_comm);
+  Mpi::Print("\nDistributing {:d} frequency steps across {:d} process groups\n",
+             nstep - step0, ngroups);
+
+  // Each group writes its postprocessing outputs to a subdirectory of the output directory.
+  const int width = 1 + static_cast<int>(std::log10(std::max(ngroups - 1, 1)));
+  std::vector<std::string> group_dirs(ngroups);
+  for (int g = 0; g < ngroups; g++)
+  {
+    group_dirs[g] = fmt::format("{}freqgroup{:0{}d}/", post_dir, g, width);
+  }
+  long long int ntdof;
+  {
+    std::vector<std::unique_ptr<Mesh>> group_mesh;
+    {
+      BlockTimer bt(Timer::CONSTRUCT);
+      group_mesh.push_back(
+          std::make_unique<Mesh>(mesh::ReplicateMesh(mesh.back()->Get(), group_comm)));
+    }
+
+    IoData group_iodata(iodata);
+    const int nstep_group = GetNumGroupSteps(nstep - step0, ngroups, color);
+    group_iodata.problem.output = group_dirs[color];
+    group_iodata.solver.driven.min_f = driven.min_f + (step0 + color) * driven.delta_f;
+    group_iodata.solver.driven.delta_f = ngroups * driven.delta_f;
+    group_iodata.solver.driven.max_f =
+        group_iodata.solver.driven.min_f +
+        (nstep_group - 1) * group_iodata.solver.driven.delta_f;
+    group_iodata.solver.driven.rst = 1;
+    group_iodata.solver.driven.freq_groups = 1;
+
+    DrivenSolver group_solver(group_iodata, Mpi::Root(group_comm), Mpi::Size(group_comm));
+    ntdof = group_solver.Solve(group_mesh).second;
+  }
+
+  // Merge the per-frequency postprocessing outputs and the metadata from all groups.
+  BlockTimer bt(Timer::POSTPRO);
+  Mpi::Barrier(comm);
+  if (root)
+  {
+    MergeFrequencyGroupOutputs(group_dirs, post_dir, nstep - step0, step0 > 0);
+    MergeMetadata(group_dirs, "FrequencyGroups");
+  }
+  MPI_Comm_free(&group_comm);
+  return {ErrorIndicator(), ntdof};
+}
+
 std::pair<ErrorIndicator, long long int>
 DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
 {
+  if (iodata.solver.driven.freq_groups > 1)
+  {
+    return SolveFrequencyGroups(mesh);
+  }
+
   // Set up the spatial discretization and frequency sweep.
   BlockTimer bt0(Timer::CONSTRUCT);
   SpaceOperator spaceop(iodata, mesh);
@@ -97,6 +284,14 @@ DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     MFEM_VERIFY(excitations > 0, "No excitation specified for driven simulation!");
   }
   Mpi::Print("\n");
+  if (iodata.solver.driven.full_s_matrix)
+  {
+    MFEM_VERIFY(!adaptive,
+                "Full S-matrix computation is not supported for adaptive frequency sweep!");
+    const auto num_src = GetSMatrixExcitations(spaceop).first.size();
+    Mpi::Print(" Computing full S-matrix for {:d} port excitation{}\n", num_src,
+               (num_src > 1) ? "s" : "");
+  }
 
   // Main frequency sweep loop.
   return {adaptive ? SweepAdaptive(spaceop, postop, nstep, step0, omega0, delta_omega)
@@ -113,6 +308,12 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &spaceop, PostOperator &
   // Because the Dirichlet BC is always homogeneous, no special elimination is required on
   // the RHS. Assemble the linear system for the initial frequency (so we can call
   // KspSolver::SetOperators). Compute everything at the first frequency step.
+  // Frequencies are swept in increasing order, so wave port modes which are interpolated
+  // between exact solves use exact solves scheduled a few steps ahead of the current
+  // frequency.
+  constexpr int mode_anchor_steps = 4;
+  spaceop.GetWavePortOp().SetModeAnchors(mode_anchor_steps * delta_omega,
+                                         omega0 + (nstep - step0 - 1) * delta_omega);
   auto K = spaceop.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ONE);
   auto C = spaceop.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
   auto M = spaceop.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
@@ -131,6 +332,14 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &spaceop, PostOperator &
   ComplexKspSolver ksp(iodata, spaceop.GetNDSpaces(), &spaceop.GetH1Spaces());
   ksp.SetOperators(*A, *P);
 
+  // Optionally reuse the preconditioner across frequency steps. It is rebuilt once the
+  // number of linear solver iterations grows beyond the specified factor relative to the
+  // first solve after the last setup.
+  const double pc_reuse_its_growth = iodata.solver.linear.pc_reuse_its_growth;
+  int pc_ref_its = -1, last_its = 0;
+  bool pc_reused = false;
+  SweepStepData step_data;
+
   // Set up RHS vector for the incident field at port boundaries, and the vector for the
   // first frequency step.
   ComplexVector RHS(Curl.Width()), E(Curl.Width()), B(Curl.Height());
@@ -140,6 +349,25 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &spaceop, PostOperator &
   E = 0.0;
   B = 0.0;
 
+  // When computing the full S-matrix, each excited port defines its own RHS and solution
+  // vector and all are solved with the same operators and preconditioner. The solution for
+  // the combined excitation, used for all other postprocessing, follows by superposition.
+  std::vector<int> src_idx;
+  bool src_lumped_port = true;
+  if (iodata.solver.driven.full_s_matrix)
+  {
+    std::tie(src_idx, src_lumped_port) = GetSMatrixExcitations(spaceop);
+  }
+  std::vector<ComplexVector> RHSs(src_idx.size()), Es(src_idx.size());
+  for (std::size_t j = 0; j < src_idx.size(); j++)
+  {
+    RHSs[j].SetSize(Curl.Width());
+    Es[j].SetSize(Curl.Width());
+    RHSs[j].UseDevice(true);
+    Es[j].UseDevice(true);
+    Es[j] = 0.0;
+  }
+
   // Initialize structures for storing and reducing the results of error estimation.
   CurlFluxErrorEstimator<ComplexVector> estimator(
       spaceop.GetMaterialOp(), spaceop.GetNDSpaces(), iodata.solver.linear.estimator_tol,
@@ -157,6 +385,7 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &spaceop, PostOperator &
                nstep, freq, Timer::Duration(Timer::Now() - t0).count());
 
     // Assemble and solve the linear system.
+    auto t_setup = Timer::Now();
     if (step > step0)
     {
       // Update frequency-dependent excitation and operators.
@@ -164,18 +393,72 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &spaceop, PostOperator &
       A = spaceop.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
                                   std::complex<double>(-omega * omega, 0.0), K.get(),
                                   C.get(), M.get(), A2.get());
-      P = spaceop.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
-                                                           omega);
-      ksp.SetOperators(*A, *P);
+      if (pc_reuse_its_growth > 0.0 &&
+          last_its <= pc_reuse_its_growth * std::max(pc_ref_its, 1))
+      {
+        Mpi::Print(" Reusing preconditioner ({:d} iterations for previous solve)\n",
+                   last_its);
+        ksp.SetOperator(*A);
+        pc_reused = true;
+      }
+      else
+      {
+        P = spaceop.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
+                                                             omega);
+        ksp.SetOperators(*A, *P);
+        pc_ref_its = -1;
+        pc_reused = false;
+      }
     }
-    spaceop.GetExcitationVector(omega, RHS);
-    Mpi::Print("\n");
-    ksp.Mult(RHS, E);
+    auto t_solve = Timer::Now();
+    const int it0 = ksp.NumTotalMultIterations();
+    if (src_idx.empty())
+    {
+      spaceop.GetExcitationVector(omega, RHS);
+      Mpi::Print("\n");
+      ksp.Mult(RHS, E);
+    }
+    else
+    {
+      for (std::size_t j = 0; j < src_idx.size(); j++)
+      {
+        if (src_lumped_port)
+        {
+          spaceop.GetLumpedPortExcitationVector(src_idx[j], omega, RHSs[j]);
+        }
+        else
+        {
+          spaceop.GetWavePortExcitationVector(src_idx[j], omega, RHSs[j]);
+        }
+      }
+      Mpi::Print("\n");
+      ksp.Mult(RHSs, Es);
+      RHS = 0.0;
+      E = 0.0;
+      for (std::size_t j = 0; j < src_idx.size(); j++)
+      {
+        RHS += RHSs[j];
+        E += Es[j];
+      }
+    }
+    last_its = ksp.NumTotalMultIterations() - it0;
+    if (pc_ref_its < 0)
+    {
+      pc_ref_its = last_its;
+    }
+    step_data.its.push_back(last_its);
+    step_data.pc_reused.push_back(pc_reused);
+    step_data.setup_time.push_back(Timer::Duration(t_solve - t_setup).count());
+    step_data.solve_time.push_back(Timer::Duration(Timer::Now() - t_solve).count());
 
     // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
     // PostOperator for all postprocessing operations.
     BlockTimer bt0(Timer::POSTPRO);
     double E_elec = 0.0, E_mag = 0.0;
+    if (!src_idx.empty())
+    {
+      PostprocessSMatrix(postop, spaceop, src_idx, src_lumped_port, Es, B, step, omega);
+    }
     Curl.Mult(E.Real(), B.Real());
     Curl.Mult(E.Imag(), B.Imag());
     B *= -1.0 / (1i * omega);
@@ -210,6 +493,7 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &spaceop, PostOperator &
   }
   BlockTimer bt0(Timer::POSTPRO);
   SaveMetadata(ksp);
+  SaveMetadata(step_data);
   return indicator;
 }
 
@@ -260,30 +544,66 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &spaceop, PostOperator
   // Initialize the basis with samples from the top and bottom of the frequency
   // range of interest. Each call for an HDM solution adds the frequency sample to P_S and
   // removes it from P \ P_S. Timing for the HDM construction and solve is handled inside
-  // of the RomOperator.
-  promop.SolveHDM(omega0, E);
-  promop.UpdatePROM(omega0, E);
-  estimator.AddErrorIndicator(E, indicator);
-  promop.SolveHDM(omega0 + (nstep - step0 - 1) * delta_omega, E);
-  promop.UpdatePROM(omega0 + (nstep - step0 - 1) * delta_omega, E);
-  estimator.AddErrorIndicator(E, indicator);
+  // of the RomOperator. If a previously saved PROM is loaded, the endpoints are only
+  // sampled if they lie outside of the range of the loaded samples.
+  const double omega1 = omega0 + (nstep - step0 - 1) * delta_omega;
+  if (!iodata.solver.driven.adaptive_load_basis.empty())
+  {
+    promop.LoadBasis(iodata.solver.driven.adaptive_load_basis);
+    const auto &z = promop.GetSamplePoints();
+    const double z_min = *std::min_element(z.begin(), z.end());
+    const double z_max = *std::max_element(z.begin(), z.end());
+    Mpi::Print(" Loaded PROM with {:d} frequency samples over [{:.3e}, {:.3e}] GHz "
+               "(n = {:d})\n",
+               z.size(), z_min * f0, z_max * f0, promop.GetReducedDimension());
+    for (double omega : {omega0, omega1})
+    {
+      if (omega < z_min || omega > z_max)
+      {
+        promop.SolveHDM(omega, E);
+        promop.UpdatePROM(omega, E);
+        estimator.AddErrorIndicator(E, indicator);
+      }
+    }
+  }
+  else
+  {
+    promop.SolveHDM(omega0, E);
+    promop.UpdatePROM(omega0, E);
+    estimator.AddErrorIndicator(E, indicator);
+    promop.SolveHDM(omega1, E);
+    promop.UpdatePROM(omega1, E);
+    estimator.AddErrorIndicator(E, indicator);
+  }
 
   // Greedy procedure for basis construction (offline phase). Basis is initialized with
-  // solutions at frequency sweep endpoints.
-  int it = 2, it0 = it, memory = 0;
-  std::vector<double> max_errors = {0.0, 0.0};
-  while (true)
-  {
-    // Compute the location of the maximum error in parameter domain (bounded by the
-    // previous samples).
-    double omega_star = promop.FindMaxError()[0];
-
-    // Compute the actual solution error at the given parameter point.
-    promop.SolveHDM(omega_star, E);
-    promop.SolvePROM(omega_star, Eh);
-    linalg::AXPY(-1.0, E, Eh);
-    max_errors.push_back(linalg::Norml2(spaceop.GetComm(), Eh) /
-                         linalg::Norml2(spaceop.GetComm(), E));
+  // solutions at frequency sweep endpoints. Each iteration optionally samples a batch of
+  // points at the locations of the largest estimated errors. The offline phase is skipped
+  // entirely if a loaded PROM already contains the maximum number of samples.
+  const int batch_size = std::max(iodata.solver.driven.adaptive_batch_size, 1);
+  int it = static_cast<int>(promop.GetSamplePoints().size()), it0 = it, memory = 0;
+  std::vector<double> max_errors(it, 0.0);
+  std::vector<ComplexVector> Es;
+  const bool skip_offline = (it >= max_size);
+  while (!skip_offline)
+  {
+    // Compute the location(s) of the maximum error in parameter domain (bounded by the
+    // previous samples and the frequency sweep range).
+    const auto omega_star =
+        promop.FindMaxError(std::max(std::min(batch_size, max_size - it), 1),
+                            std::min(omega0, omega1), std::max(omega0, omega1));
+
+    // Compute the actual solution error at the given parameter point(s).
+    promop.SolveHDM(omega_star, Es);
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < omega_star.size(); i++)
+    {
+      promop.SolvePROM(omega_star[i], Eh);
+      linalg::AXPY(-1.0, Es[i], Eh);
+      max_error = std::max(max_error, linalg::Norml2(spaceop.GetComm(), Eh) /
+                                          linalg::Norml2(spaceop.GetComm(), Es[i]));
+    }
+    max_errors.push_back(max_error);
     if (max_errors.back() < offline_tol)
     {
       if (++memory == convergence_memory)
@@ -300,21 +620,38 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &spaceop, PostOperator
       break;
     }
 
-    // Sample HDM and add solution to basis.
-    Mpi::Print("\nGreedy iteration {:d} (n = {:d}): ω* = {:.3e} GHz ({:.3e}), error = "
-               "{:.3e}{}\n",
-               it - it0 + 1, promop.GetReducedDimension(), omega_star * f0, omega_star,
-               max_errors.back(),
-               (memory == 0)
-                   ? ""
-                   : fmt::format(", memory = {:d}/{:d}", memory, convergence_memory));
-    promop.UpdatePROM(omega_star, E);
-    estimator.AddErrorIndicator(E, indicator);
-    it++;
+    // Sample HDM and add solution(s) to basis.
+    if (omega_star.size() == 1)
+    {
+      Mpi::Print("\nGreedy iteration {:d} (n = {:d}): ω* = {:.3e} GHz ({:.3e}), error = "
+                 "{:.3e}{}\n",
+                 it - it0 + 1, promop.GetReducedDimension(), omega_star[0] * f0,
+                 omega_star[0], max_errors.back(),
+                 (memory == 0)
+                     ? ""
+                     : fmt::format(", memory = {:d}/{:d}", memory, convergence_memory));
+    }
+    else
+    {
+      Mpi::Print("\nGreedy iteration {:d} (n = {:d}): {:d} samples, max. error = "
+                 "{:.3e}{}\n",
+                 it - it0 + 1, promop.GetReducedDimension(), omega_star.size(),
+                 max_errors.back(),
+                 (memory == 0)
+                     ? ""
+                     : fmt::format(", memory = {:d}/{:d}", memory, convergence_memory));
+      utils::PrettyPrint(omega_star, f0, " ω* (GHz):");
+    }
+    promop.UpdatePROM(omega_star, Es);
+    for (const auto &Ei : Es)
+    {
+      estimator.AddErrorIndicator(Ei, indicator);
+    }
+    it += static_cast<int>(omega_star.size());
   }
   Mpi::Print("\nAdaptive sampling{} {:d} frequency samples:\n"
              " n = {:d}, error = {:.3e}, tol = {:.3e}, memory = {:d}/{:d}\n",
-             (it == max_size) ? " reached maximum" : " converged with", it,
+             (it >= max_size) ? " reached maximum" : " converged with", it,
              promop.GetReducedDimension(), max_errors.back(), offline_tol, memory,
              convergence_memory);
   utils::PrettyPrint(promop.GetSamplePoints(), f0, " Sampled frequencies (GHz):");
@@ -322,12 +659,40 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &spaceop, PostOperator
   Mpi::Print(" Total offline phase elapsed time: {:.2e} s\n",
              Timer::Duration(Timer::Now() - t0).count());  // Timing on root
 
+  // Optionally save the PROM for use in a later simulation.
+  if (iodata.solver.driven.adaptive_save_basis)
+  {
+    promop.SaveBasis(post_dir + "prom/");
+  }
+
   // XX TODO: Add output of eigenvalue estimates from the PROM system (and nonlinear EVP in
   //          the general case with wave ports, etc.?)
 
   // Main fast frequency sweep loop (online phase).
   Mpi::Print("\nBeginning fast frequency sweep online phase\n");
   spaceop.GetWavePortOp().SetSuppressOutput(false);  // Disable output suppression
+
+  // When only port postprocessing is requested, lumped port voltages and S-parameters are
+  // evaluated directly from the reduced-order solution using functionals projected onto the
+  // reduced-order basis, and the full field solution is only reconstructed at steps where
+  // fields are written to disk. Wave port postprocessing depends on the frequency-dependent
+  // port mode and always requires the full field solution.
+  const bool reduced_post =
+      iodata.solver.driven.only_port_post && spaceop.GetWavePortOp().Size() == 0;
+  std::map<int, Eigen::VectorXd> Vr, Sr;
+  std::map<int, std::complex<double>> port_V, port_S;
+  if (reduced_post)
+  {
+    BlockTimer bt0(Timer::CONSTRUCT_PROM);
+    Vector s_t, v_t;
+    for (const auto &[idx, data] : spaceop.GetLumpedPortOp())
+    {
+      data.GetTrueDofLinearForms(spaceop.GetNDSpace().Get(), s_t, v_t);
+      Sr[idx] = promop.ProjectLinearForm(s_t);
+      Vr[idx] = promop.ProjectLinearForm(v_t);
+    }
+  }
+
   int step = step0;
   double omega = omega0;
   while (step < nstep)
@@ -337,20 +702,47 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &spaceop, PostOperator
                nstep, freq, Timer::Duration(Timer::Now() - t0).count());
 
     // Assemble and solve the PROM linear system.
-    promop.SolvePROM(omega, E);
+    const bool save_fields = (iodata.solver.driven.delta_post > 0 &&
+                              step % iodata.solver.driven.delta_post == 0);
+    if (reduced_post && !save_fields)
+    {
+      promop.SolvePROM(omega);
+    }
+    else
+    {
+      promop.SolvePROM(omega, E);
+    }
     Mpi::Print("\n");
 
     // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for all postprocessing operations.
+    // PostOperator for all postprocessing operations. The basis is orthonormal, so the norm
+    // of the reduced-order solution is that of the expanded solution.
     BlockTimer bt0(Timer::POSTPRO);
     double E_elec = 0.0, E_mag = 0.0;
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    postop.SetEGridFunction(E);
-    postop.SetBGridFunction(B);
-    postop.UpdatePorts(spaceop.GetLumpedPortOp(), spaceop.GetWavePortOp(), omega);
-    Mpi::Print(" Sol. ||E|| = {:.6e}\n", linalg::Norml2(spaceop.GetComm(), E));
+    if (!reduced_post || save_fields)
+    {
+      Curl.Mult(E.Real(), B.Real());
+      Curl.Mult(E.Imag(), B.Imag());
+      B *= -1.0 / (1i * omega);
+      postop.SetEGridFunction(E);
+      postop.SetBGridFunction(B);
+    }
+    if (reduced_post)
+    {
+      const auto &y = promop.GetReducedSolution();
+      for (const auto &[idx, data] : spaceop.GetLumpedPortOp())
+      {
+        port_V[idx] = Vr[idx].cast<std::complex<double>>().dot(y);
+        port_S[idx] = Sr[idx].cast<std::complex<double>>().dot(y);
+      }
+      postop.UpdatePorts(spaceop.GetLumpedPortOp(), port_V, port_S, omega);
+      Mpi::Print(" Sol. ||E|| = {:.6e}\n", y.norm());
+    }
+    else
+    {
+      postop.UpdatePorts(spaceop.GetLumpedPortOp(), spaceop.GetWavePortOp(), omega);
+      Mpi::Print(" Sol. ||E|| = {:.6e}\n", linalg::Norml2(spaceop.GetComm(), E));
+    }
     if (!iodata.solver.driven.only_port_post)
     {
       const double J = iodata.DimensionalizeValue(IoData::ValueType::ENERGY, 1.0);
@@ -402,7 +794,7 @@ void DrivenSolver::Postprocess(const PostOperator &postop,
   double freq = iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega);
   PostprocessCurrents(postop, surf_j_op, step, omega);
   PostprocessPorts(postop, lumped_port_op, step, omega);
-  if (surf_j_op.Size() == 0)
+  if (surf_j_op.Size() == 0 && !iodata.solver.driven.full_s_matrix)
   {
     PostprocessSParameters(postop, lumped_port_op, wave_port_op, step, omega);
   }
@@ -753,4 +1145,111 @@ void DrivenSolver::PostprocessSParameters(const PostOperator &postop,
   }
 }
 
+void DrivenSolver::PostprocessSMatrix(PostOperator &postop, const SpaceOperator &spaceop,
+                                      const std::vector<int> &src_idx,
+                                      bool src_lumped_port,
+                                      const std::vector<ComplexVector> &E, ComplexVector &B,
+                                      int step, double omega) const
+{
+  // Postprocess the full S-matrix, computing one column for each excited port index from
+  // the solution for that excitation. This overwrites the internal GridFunctions of
+  // PostOperator, which must be set again afterwards for any other postprocessing.
+  const auto &Curl = spaceop.GetCurlMatrix();
+  const auto &lumped_port_op = spaceop.GetLumpedPortOp();
+  const auto &wave_port_op = spaceop.GetWavePortOp();
+  std::vector<int> port_idx;
+  if (src_lumped_port)
+  {
+    for (const auto &[idx, data] : lumped_port_op)
+    {
+      port_idx.push_back(idx);
+    }
+  }
+  else
+  {
+    for (const auto &[idx, data] : wave_port_op)
+    {
+      port_idx.push_back(idx);
+    }
+  }
+  std::vector<std::complex<double>> S(port_idx.size() * src_idx.size());
+  for (std::size_t j = 0; j < src_idx.size(); j++)
+  {
+    Curl.Mult(E[j].Real(), B.Real());
+    Curl.Mult(E[j].Imag(), B.Imag());
+    B *= -1.0 / (1i * omega);
+    postop.SetEGridFunction(E[j]);
+    postop.SetBGridFunction(B);
+    postop.UpdatePorts(lumped_port_op, wave_port_op, omega);
+    for (std::size_t i = 0; i < port_idx.size(); i++)
+    {
+      S[j * port_idx.size() + i] =
+          src_lumped_port ? postop.GetSParameter(lumped_port_op, port_idx[i], src_idx[j])
+                          : postop.GetSParameter(wave_port_op, port_idx[i], src_idx[j]);
+    }
+  }
+
+  // Print table to stdout.
+  for (std::size_t j = 0; j < src_idx.size(); j++)
+  {
+    for (std::size_t i = 0; i < port_idx.size(); i++)
+    {
+      const auto &Sij = S[j * port_idx.size() + i];
+      std::string str =
+          "S[" + std::to_string(port_idx[i]) + "][" + std::to_string(src_idx[j]) + "]";
+      // clang-format off
+      Mpi::Print(" {} = {:+.3e}{:+.3e}i, |{}| = {:+.3e}, arg({}) = {:+.3e}\n",
+                 str, Sij.real(), Sij.imag(),
+                 str, 20.0 * std::log10(std::abs(Sij)),
+                 str, std::arg(Sij) * 180.0 / M_PI);
+      // clang-format on
+    }
+  }
+
+  // Print table to file.
+  if (root && post_dir.length() > 0)
+  {
+    std::string path = post_dir + "port-S.csv";
+    auto output = OutputFile(path, (step > 0));
+    if (step == 0)
+    {
+      output.print("{:>{}s},", "f (GHz)", table.w1);
+      for (std::size_t j = 0; j < src_idx.size(); j++)
+      {
+        for (std::size_t i = 0; i < port_idx.size(); i++)
+        {
+          std::string str =
+              "S[" + std::to_string(port_idx[i]) + "][" + std::to_string(src_idx[j]) + "]";
+          // clang-format off
+          output.print("{:>{}s},{:>{}s}{}",
+                       "|" + str + "| (dB)", table.w,
+                       "arg(" + str + ") (deg.)", table.w,
+                       (j == src_idx.size() - 1 && i == port_idx.size() - 1) ? "" : ",");
+          // clang-format on
+        }
+      }
+      output.print("\n");
+    }
+    // clang-format off
+    output.print("{:{}.{}e},",
+                 iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega),
+                 table.w1, table.p1);
+    // clang-format on
+    for (std::size_t j = 0; j < src_idx.size(); j++)
+    {
+      for (std::size_t i = 0; i < port_idx.size(); i++)
+      {
+        const auto &Sij = S[j * port_idx.size() + i];
+        // clang-format off
+        output.print("{:>+{}.{}e},{:>+{}.{}e}{}",
+                     20.0 * std::log10(std::abs(Sij)), table.w, table.p,
+                     std::arg(Sij) * 180.0 / M_PI, table.w, table.p,
+                     (j == src_idx.size() - 1 && i == port_idx.size() - 1) ? "" : ",");
+        // clang-format on
+      }
+    }
+    output.print("\n");
+  }
+}
+
 }  // namespace palace
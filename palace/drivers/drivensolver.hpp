@@ -11,6 +11,7 @@
 namespace palace
 {
 
+class ComplexVector;
 class ErrorIndicator;
 class IoData;
 class LumpedPortOperator;
@@ -54,6 +55,14 @@ private:
                               const WavePortOperator &wave_port_op, int step,
                               double omega) const;
 
+  void PostprocessSMatrix(PostOperator &postop, const SpaceOperator &spaceop,
+                          const std::vector<int> &src_idx, bool src_lumped_port,
+                          const std::vector<ComplexVector> &E, ComplexVector &B, int step,
+                          double omega) const;
+
+  std::pair<ErrorIndicator, long long int>
+  SolveFrequencyGroups(const std::vector<std::unique_ptr<Mesh>> &mesh) const;
+
   std::pair<ErrorIndicator, long long int>
   Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const override;
 
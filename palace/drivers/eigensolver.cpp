@@ -9,6 +9,7 @@
 #include "linalg/arpack.hpp"
 #include "linalg/divfree.hpp"
 #include "linalg/errorestimator.hpp"
+#include "linalg/feast.hpp"
 #include "linalg/ksp.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/slepc.hpp"
@@ -60,23 +61,39 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   {
     Mpi::Warning("SLEPc eigensolver not available, using ARPACK!\n");
   }
-  else if (iodata.solver.eigenmode.type == config::EigenSolverData::Type::FEAST)
+  if (type != config::EigenSolverData::Type::FEAST)
   {
-    Mpi::Warning("FEAST eigensolver requires SLEPc, using ARPACK!\n");
+    type = config::EigenSolverData::Type::ARPACK;
   }
-  type = config::EigenSolverData::Type::ARPACK;
 #elif defined(PALACE_WITH_SLEPC)
   if (iodata.solver.eigenmode.type == config::EigenSolverData::Type::ARPACK)
   {
     Mpi::Warning("ARPACK eigensolver not available, using SLEPc!\n");
   }
-  type = config::EigenSolverData::Type::SLEPC;
+  if (type != config::EigenSolverData::Type::FEAST)
+  {
+    type = config::EigenSolverData::Type::SLEPC;
+  }
 #else
 #error "Eigenmode solver requires building with ARPACK or SLEPc!"
 #endif
+  feast::FeastEigenvalueSolver *feast = nullptr;
   if (type == config::EigenSolverData::Type::FEAST)
   {
-    MFEM_ABORT("FEAST eigenvalue solver is currently not supported!");
+    Mpi::Print("\nConfiguring FEAST eigenvalue solver:\n");
+    std::unique_ptr<feast::FeastEigenvalueSolver> contour;
+    if (C)
+    {
+      contour = std::make_unique<feast::FeastPEPSolver>(spaceop.GetComm(),
+                                                         iodata.problem.verbose);
+    }
+    else
+    {
+      contour = std::make_unique<feast::FeastEPSSolver>(spaceop.GetComm(),
+                                                         iodata.problem.verbose);
+    }
+    feast = contour.get();
+    eigen = std::move(contour);
   }
   else if (type == config::EigenSolverData::Type::ARPACK)
   {
@@ -123,7 +140,9 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     slepc->SetProblemType(slepc::SlepcEigenvalueSolver::ProblemType::GEN_NON_HERMITIAN);
     slepc->SetOrthogonalization(
         iodata.solver.linear.gs_orthog_type == config::LinearSolverData::OrthogType::MGS,
-        iodata.solver.linear.gs_orthog_type == config::LinearSolverData::OrthogType::CGS2);
+        iodata.solver.linear.gs_orthog_type == config::LinearSolverData::OrthogType::CGS2 ||
+            iodata.solver.linear.gs_orthog_type ==
+                config::LinearSolverData::OrthogType::CGS2_FUSED);
     eigen = std::move(slepc);
 #endif
   }
@@ -244,16 +263,54 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   // Set up the linear solver required for solving systems involving the shifted operator
   // (K - σ² M) or P(iσ) = (K + iσ C - σ² M) during the eigenvalue solve. The
   // preconditioner for complex linear systems is constructed from a real approximation
-  // to the complex system matrix.
-  auto A = spaceop.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * target,
-                                   std::complex<double>(-target * target, 0.0), K.get(),
-                                   C.get(), M.get());
-  auto P = spaceop.GetPreconditionerMatrix<ComplexOperator>(1.0, target, -target * target,
-                                                            target);
-  auto ksp = std::make_unique<ComplexKspSolver>(iodata, spaceop.GetNDSpaces(),
-                                                &spaceop.GetH1Spaces());
-  ksp->SetOperators(*A, *P);
-  eigen->SetLinearSolver(*ksp);
+  // to the complex system matrix. The FEAST solver instead requires a linear solver at each
+  // quadrature node z of the contour enclosing the frequency window [σ, σ_upper], which
+  // are reused across all subspace iterations.
+  std::vector<std::unique_ptr<ComplexOperator>> A, P;
+  std::vector<std::unique_ptr<ComplexKspSolver>> ksp;
+  std::vector<std::complex<double>> shifts = {C ? 1i * target
+                                                : std::complex<double>(target * target)};
+  if (feast)
+  {
+    const double target_ub = iodata.solver.eigenmode.feast_contour_ub;
+    MFEM_VERIFY(target_ub > target,
+                "FEAST eigenvalue solver requires \"ContourTargetUpper\" > \"Target\"!");
+    const double f_target_ub =
+        iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, target_ub);
+    Mpi::Print(" Contour σ_upper = {:.3e} GHz ({:.3e}), aspect ratio = {:.3e}, "
+               "{:d} quadrature points\n",
+               f_target_ub, target_ub, iodata.solver.eigenmode.feast_contour_ar,
+               iodata.solver.eigenmode.feast_contour_np);
+    feast->SetContour(shifts[0],
+                      C ? 1i * target_ub : std::complex<double>(target_ub * target_ub),
+                      iodata.solver.eigenmode.feast_contour_ar,
+                      iodata.solver.eigenmode.feast_contour_np,
+                      iodata.solver.eigenmode.feast_moments);
+    shifts = feast->GetContourNodes();
+  }
+  for (std::size_t k = 0; k < shifts.size(); k++)
+  {
+    // The shifted operator is (K - z M) for the linear problem, with z = ω², or
+    // P(z) = (K + z C + z² M) for the quadratic problem, with z = iω.
+    const auto z = shifts[k];
+    const auto omega = C ? z / 1i : std::sqrt(z);
+    A.push_back(spaceop.GetSystemMatrix(std::complex<double>(1.0, 0.0),
+                                        C ? z : std::complex<double>(0.0, 0.0),
+                                        C ? z * z : -z, K.get(), C.get(), M.get()));
+    P.push_back(spaceop.GetPreconditionerMatrix<ComplexOperator>(
+        1.0, omega.real(), -omega.real() * omega.real(), omega.real()));
+    ksp.push_back(std::make_unique<ComplexKspSolver>(iodata, spaceop.GetNDSpaces(),
+                                                     &spaceop.GetH1Spaces()));
+    ksp.back()->SetOperators(*A.back(), *P.back());
+    if (feast)
+    {
+      feast->SetLinearSolver(static_cast<int>(k), *ksp.back());
+    }
+    else
+    {
+      eigen->SetLinearSolver(*ksp.back());
+    }
+  }
 
   // Eigenvalue problem solve.
   BlockTimer bt1(Timer::EPS);
@@ -268,7 +325,14 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
                    : "");
   }
   BlockTimer bt2(Timer::POSTPRO);
-  SaveMetadata(*ksp);
+  if (feast)
+  {
+    SaveMetadata(*feast);
+  }
+  else
+  {
+    SaveMetadata(*ksp[0]);
+  }
 
   // Calculate and record the error indicators.
   Mpi::Print("\nComputing solution error estimates\n");
@@ -284,7 +348,10 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     eigen->SetBMat(*KM);
     eigen->RescaleEigenvectors(num_conv);
   }
-  for (int i = 0; i < iodata.solver.eigenmode.n; i++)
+  const int num_est =
+      feast ? std::min(iodata.solver.eigenmode.n, feast->GetNumEigenpairs())
+            : iodata.solver.eigenmode.n;
+  for (int i = 0; i < num_est; i++)
   {
     eigen->GetEigenvector(i, E);
     estimator.AddErrorIndicator(E, indicator);
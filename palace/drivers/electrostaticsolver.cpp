@@ -41,8 +41,7 @@ ElectrostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   MFEM_VERIFY(nstep > 0, "No terminal boundaries specified for electrostatic simulation!");
 
   // Right-hand side term and solution vector storage.
-  Vector RHS(K->Height());
-  std::vector<Vector> V(nstep);
+  std::vector<Vector> RHS(nstep), V(nstep);
 
   // Initialize structures for storing and reducing the results of error estimation.
   GradFluxErrorEstimator estimator(
@@ -51,26 +50,31 @@ ElectrostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
       iodata.solver.linear.estimator_mg);
   ErrorIndicator indicator;
 
-  // Main loop over terminal boundaries.
+  // Form the linear systems for a prescribed nonzero voltage on each terminal and solve
+  // them together, since they share the same operator and preconditioner.
   Mpi::Print("\nComputing electrostatic fields for {:d} terminal boundar{}\n", nstep,
              (nstep > 1) ? "ies" : "y");
   int step = 0;
+  for (const auto &[idx, data] : laplaceop.GetSources())
+  {
+    laplaceop.GetExcitationVector(idx, *K, V[step], RHS[step]);
+    step++;
+  }
+  Mpi::Print("\n");
+  ksp.Mult(RHS, V);
+
+  // Main loop over terminal boundaries.
+  step = 0;
   auto t0 = Timer::Now();
   for (const auto &[idx, data] : laplaceop.GetSources())
   {
     Mpi::Print("\nIt {:d}/{:d}: Index = {:d} (elapsed time = {:.2e} s)\n", step + 1, nstep,
                idx, Timer::Duration(Timer::Now() - t0).count());
 
-    // Form and solve the linear system for a prescribed nonzero voltage on the specified
-    // terminal.
-    Mpi::Print("\n");
-    laplaceop.GetExcitationVector(idx, *K, V[step], RHS);
-    ksp.Mult(RHS, V[step]);
-
     BlockTimer bt2(Timer::POSTPRO);
     Mpi::Print(" Sol. ||V|| = {:.6e} (||RHS|| = {:.6e})\n",
                linalg::Norml2(laplaceop.GetComm(), V[step]),
-               linalg::Norml2(laplaceop.GetComm(), RHS));
+               linalg::Norml2(laplaceop.GetComm(), RHS[step]));
 
     // Calculate and record the error indicators.
     Mpi::Print(" Updating solution error estimates\n");
@@ -100,8 +104,13 @@ void ElectrostaticSolver::Postprocess(LaplaceOperator &laplaceop, PostOperator &
   const auto &Grad = laplaceop.GetGradMatrix();
   const std::map<int, mfem::Array<int>> &terminal_sources = laplaceop.GetSources();
   int nstep = static_cast<int>(terminal_sources.size());
-  mfem::DenseMatrix C(nstep), Cm(nstep);
-  Vector E(Grad.Height()), Vij(Grad.Width());
+
+  // With unit voltage excitations, the electric field energy for V_i + V_j is expanded as
+  // U_e(V_i + V_j) = 1/2 (C_ii + C_jj) + C_ij, so the capacitance matrix is simply the
+  // matrix C_ij = V_iᵀ K V_j of mutual energies, computed with a single reduction.
+  mfem::DenseMatrix C, Cm(nstep);
+  postop.GetEFieldEnergyMatrix(V, C);
+  Vector E(Grad.Height());
   int i = 0;
   for (const auto &[idx, data] : terminal_sources)
   {
@@ -111,7 +120,7 @@ void ElectrostaticSolver::Postprocess(LaplaceOperator &laplaceop, PostOperator &
     Grad.AddMult(V[i], E, -1.0);
     postop.SetVGridFunction(V[i]);
     postop.SetEGridFunction(E);
-    double Ue = postop.GetEFieldEnergy();
+    double Ue = 0.5 * C(i, i);
     PostprocessDomains(postop, "i", i, idx, Ue, 0.0, 0.0, 0.0);
     PostprocessSurfaces(postop, "i", i, idx, Ue, 0.0, 1.0, 0.0);
     PostprocessProbes(postop, "i", i, idx);
@@ -124,30 +133,17 @@ void ElectrostaticSolver::Postprocess(LaplaceOperator &laplaceop, PostOperator &
     {
       PostprocessErrorIndicator(postop, indicator);
     }
-
-    // Diagonal: C_ii = 2 U_e(V_i) / V_i².
-    C(i, i) = Cm(i, i) = 2.0 * Ue;
     i++;
   }
 
-  // Off-diagonals: C_ij = U_e(V_i + V_j) / (V_i V_j) - 1/2 (V_i/V_j C_ii + V_j/V_i C_jj).
+  // Mutual capacitance matrix: Cm_ij = -C_ij for i ≠ j, and Cm_ii = Σ_j C_ij.
   for (i = 0; i < C.Height(); i++)
   {
+    Cm(i, i) = C(i, i);
     for (int j = 0; j < C.Width(); j++)
     {
-      if (j < i)
-      {
-        // Copy lower triangle from already computed upper triangle.
-        C(i, j) = C(j, i);
-        Cm(i, j) = Cm(j, i);
-        Cm(i, i) -= Cm(i, j);
-      }
-      else if (j > i)
+      if (j != i)
       {
-        linalg::AXPBYPCZ(1.0, V[i], 1.0, V[j], 0.0, Vij);
-        postop.SetVGridFunction(Vij, false);
-        double Ue = postop.GetEFieldEnergy();
-        C(i, j) = Ue - 0.5 * (C(i, i) + C(j, j));
         Cm(i, j) = -C(i, j);
         Cm(i, i) -= Cm(i, j);
       }
@@ -41,8 +41,7 @@ MagnetostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
               "No surface current boundaries specified for magnetostatic simulation!");
 
   // Source term and solution vector storage.
-  Vector RHS(K->Height());
-  std::vector<Vector> A(nstep);
+  std::vector<Vector> RHS(nstep), A(nstep);
 
   // Initialize structures for storing and reducing the results of error estimation.
   CurlFluxErrorEstimator<Vector> estimator(
@@ -51,28 +50,34 @@ MagnetostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
       iodata.solver.linear.estimator_mg);
   ErrorIndicator indicator;
 
-  // Main loop over current source boundaries.
+  // Form the linear systems for a prescribed current on each source and solve them
+  // together, since they share the same operator and preconditioner.
   Mpi::Print("\nComputing magnetostatic fields for {:d} source boundar{}\n", nstep,
              (nstep > 1) ? "ies" : "y");
   int step = 0;
+  for (const auto &[idx, data] : curlcurlop.GetSurfaceCurrentOp())
+  {
+    A[step].SetSize(K->Height());
+    A[step].UseDevice(true);
+    A[step] = 0.0;
+    curlcurlop.GetExcitationVector(idx, RHS[step]);
+    step++;
+  }
+  Mpi::Print("\n");
+  ksp.Mult(RHS, A);
+
+  // Main loop over current source boundaries.
+  step = 0;
   auto t0 = Timer::Now();
   for (const auto &[idx, data] : curlcurlop.GetSurfaceCurrentOp())
   {
     Mpi::Print("\nIt {:d}/{:d}: Index = {:d} (elapsed time = {:.2e} s)\n", step + 1, nstep,
                idx, Timer::Duration(Timer::Now() - t0).count());
 
-    // Form and solve the linear system for a prescribed current on the specified source.
-    Mpi::Print("\n");
-    A[step].SetSize(RHS.Size());
-    A[step].UseDevice(true);
-    A[step] = 0.0;
-    curlcurlop.GetExcitationVector(idx, RHS);
-    ksp.Mult(RHS, A[step]);
-
     BlockTimer bt2(Timer::POSTPRO);
     Mpi::Print(" Sol. ||A|| = {:.6e} (||RHS|| = {:.6e})\n",
                linalg::Norml2(curlcurlop.GetComm(), A[step]),
-               linalg::Norml2(curlcurlop.GetComm(), RHS));
+               linalg::Norml2(curlcurlop.GetComm(), RHS[step]));
 
     // Calculate and record the error indicators.
     Mpi::Print(" Updating solution error estimates\n");
@@ -103,8 +108,13 @@ void MagnetostaticSolver::Postprocess(CurlCurlOperator &curlcurlop, PostOperator
   const auto &Curl = curlcurlop.GetCurlMatrix();
   const SurfaceCurrentOperator &surf_j_op = curlcurlop.GetSurfaceCurrentOp();
   int nstep = static_cast<int>(surf_j_op.Size());
-  mfem::DenseMatrix M(nstep), Mm(nstep);
-  Vector B(Curl.Height()), Aij(Curl.Width());
+
+  // The magnetic field energy for A_i + A_j is expanded as
+  // U_m(A_i + A_j) = 1/2 (W_ii + W_jj) + W_ij, with W_ij = A_iᵀ K A_j the matrix of mutual
+  // energies computed with a single reduction, so M_ij = W_ij / (I_i I_j).
+  mfem::DenseMatrix M, Mm(nstep);
+  postop.GetHFieldEnergyMatrix(A, M);
+  Vector B(Curl.Height());
   Vector Iinc(nstep);
   int i = 0;
   for (const auto &[idx, data] : surf_j_op)
@@ -119,7 +129,7 @@ void MagnetostaticSolver::Postprocess(CurlCurlOperator &curlcurlop, PostOperator
     Curl.Mult(A[i], B);
     postop.SetAGridFunction(A[i]);
     postop.SetBGridFunction(B);
-    double Um = postop.GetHFieldEnergy();
+    double Um = 0.5 * M(i, i);
     PostprocessDomains(postop, "i", i, idx, 0.0, Um, 0.0, 0.0);
     PostprocessSurfaces(postop, "i", i, idx, 0.0, Um, 0.0, Iinc(i));
     PostprocessProbes(postop, "i", i, idx);
@@ -132,31 +142,25 @@ void MagnetostaticSolver::Postprocess(CurlCurlOperator &curlcurlop, PostOperator
     {
       PostprocessErrorIndicator(postop, indicator);
     }
-
-    // Diagonal: M_ii = 2 U_m(A_i) / I_i².
-    M(i, i) = Mm(i, i) = 2.0 * Um / (Iinc(i) * Iinc(i));
     i++;
   }
 
-  // Off-diagonals: M_ij = U_m(A_i + A_j) / (I_i I_j) - 1/2 (I_i/I_j M_ii + I_j/I_i M_jj).
+  // Scale by the excitation currents and form the mutual inductance matrix:
+  // Mm_ij = -M_ij for i ≠ j, and Mm_ii = Σ_j M_ij.
   for (i = 0; i < M.Height(); i++)
   {
     for (int j = 0; j < M.Width(); j++)
     {
-      if (j < i)
-      {
-        // Copy lower triangle from already computed upper triangle.
-        M(i, j) = M(j, i);
-        Mm(i, j) = Mm(j, i);
-        Mm(i, i) -= Mm(i, j);
-      }
-      else if (j > i)
+      M(i, j) /= Iinc(i) * Iinc(j);
+    }
+  }
+  for (i = 0; i < M.Height(); i++)
+  {
+    Mm(i, i) = M(i, i);
+    for (int j = 0; j < M.Width(); j++)
+    {
+      if (j != i)
       {
-        linalg::AXPBYPCZ(1.0, A[i], 1.0, A[j], 0.0, Aij);
-        postop.SetAGridFunction(Aij, false);
-        double Um = postop.GetHFieldEnergy();
-        M(i, j) = Um / (Iinc(i) * Iinc(j)) -
-                  0.5 * (M(i, i) * Iinc(i) / Iinc(j) + M(j, j) * Iinc(j) / Iinc(i));
         Mm(i, j) = -M(i, j);
         Mm(i, i) -= Mm(i, j);
       }
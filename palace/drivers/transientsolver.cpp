@@ -84,15 +84,31 @@ TransientSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
       iodata.solver.linear.estimator_max_it, 0, iodata.solver.linear.estimator_mg);
   ErrorIndicator indicator;
 
-  // Main time integration loop.
+  // Main time integration loop. With adaptive time stepping, the number of time steps is
+  // not known in advance and the loop continues until the final time is reached.
   int step = 0;
   double t = -delta_t;
   auto t0 = Timer::Now();
-  while (step < nstep)
+  bool last = false;
+  while (!last)
   {
-    const double ts = iodata.DimensionalizeValue(IoData::ValueType::TIME, t + delta_t);
-    Mpi::Print("\nIt {:d}/{:d}: t = {:e} ns (elapsed time = {:.2e} s)\n", step, nstep - 1,
-               ts, Timer::Duration(Timer::Now() - t0).count());
+    if (timeop.isAdaptive())
+    {
+      if (step > 0)
+      {
+        delta_t = timeop.GetTimeStep(t, delta_t);
+      }
+      const double ts = iodata.DimensionalizeValue(IoData::ValueType::TIME, t + delta_t);
+      const double dts = iodata.DimensionalizeValue(IoData::ValueType::TIME, delta_t);
+      Mpi::Print("\nIt {:d}: t = {:e} ns, Δt = {:.3e} ns (elapsed time = {:.2e} s)\n",
+                 step, ts, dts, Timer::Duration(Timer::Now() - t0).count());
+    }
+    else
+    {
+      const double ts = iodata.DimensionalizeValue(IoData::ValueType::TIME, t + delta_t);
+      Mpi::Print("\nIt {:d}/{:d}: t = {:e} ns (elapsed time = {:.2e} s)\n", step,
+                 nstep - 1, ts, Timer::Duration(Timer::Now() - t0).count());
+    }
 
     // Single time step t -> t + dt.
     BlockTimer bt1(Timer::TS);
@@ -106,6 +122,9 @@ TransientSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     {
       timeop.Step(t, delta_t);  // Advances t internally
     }
+    last = timeop.isAdaptive() ? (t >= iodata.solver.transient.max_t -
+                                          0.5 * iodata.solver.transient.delta_t)
+                               : (step == nstep - 1);
 
     // Postprocess for the time step.
     BlockTimer bt2(Timer::POSTPRO);
@@ -133,13 +152,13 @@ TransientSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     // Postprocess port voltages/currents and optionally write solution to disk.
     Postprocess(postop, spaceop.GetLumpedPortOp(), spaceop.GetSurfaceCurrentOp(), step, t,
                 J_coef(t), E_elec, E_mag, !iodata.solver.transient.only_port_post,
-                (step == nstep - 1) ? &indicator : nullptr);
+                last ? &indicator : nullptr);
 
     // Increment time step.
     step++;
   }
   BlockTimer bt1(Timer::POSTPRO);
-  SaveMetadata(timeop.GetLinearSolver());
+  SaveMetadata(timeop.GetLinearSolverStats());
   return {indicator, spaceop.GlobalTrueVSize()};
 }
 
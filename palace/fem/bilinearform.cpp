@@ -12,15 +12,15 @@
 namespace palace
 {
 
-void BilinearForm::AssembleQuadratureData()
+void BilinearForm::AssembleQuadratureData(bool single)
 {
   for (auto &integ : domain_integs)
   {
-    integ->AssembleQuadratureData();
+    integ->AssembleQuadratureData(single);
   }
   for (auto &integ : boundary_integs)
   {
-    integ->AssembleQuadratureData();
+    integ->AssembleQuadratureData(single);
   }
 }
 
@@ -107,10 +107,18 @@ BilinearForm::PartialAssemble(const FiniteElementSpace &trial_fespace,
   return op;
 }
 
-std::unique_ptr<hypre::HypreCSRMatrix> BilinearForm::FullAssemble(const ceed::Operator &op,
-                                                                  bool skip_zeros, bool set)
+std::unique_ptr<hypre::HypreCSRMatrix> BilinearForm::FullAssemble(bool skip_zeros) const
 {
-  return ceed::CeedOperatorFullAssemble(op, skip_zeros, set);
+  auto *plans =
+      (&trial_fespace == &test_fespace) ? &test_fespace.GetCeedAssemblyPlans() : nullptr;
+  return FullAssemble(*PartialAssemble(), skip_zeros, false, plans);
+}
+
+std::unique_ptr<hypre::HypreCSRMatrix>
+BilinearForm::FullAssemble(const ceed::Operator &op, bool skip_zeros, bool set,
+                           ceed::AssemblyPlanMap *plans)
+{
+  return ceed::CeedOperatorFullAssemble(op, skip_zeros, set, plans);
 }
 
 namespace
@@ -190,7 +198,10 @@ BilinearForm::Assemble(const BaseFiniteElementSpaceHierarchy<T> &fespaces, bool
   {
     if (l == 0 || UseFullAssembly(fespaces.GetFESpaceAtLevel(l), pa_order_threshold))
     {
-      ops.push_back(FullAssemble(*pa_ops[l - l0], skip_zeros));
+      // The sparsity pattern is cached on the space for reassembly, for example for
+      // preconditioner matrices at a new frequency or time step size.
+      ops.push_back(FullAssemble(*pa_ops[l - l0], skip_zeros, false,
+                                 &fespaces.GetFESpaceAtLevel(l).GetCeedAssemblyPlans()));
     }
     else
     {
@@ -63,17 +63,19 @@ public:
     boundary_integs.push_back(std::make_unique<T>(std::forward<U>(args)...));
   }
 
-  void AssembleQuadratureData();
+  // Pre-assemble the quadrature data for all integrators, optionally stored in single
+  // precision.
+  void AssembleQuadratureData(bool single = false);
 
   std::unique_ptr<ceed::Operator> PartialAssemble() const
   {
     return PartialAssemble(GetTrialSpace(), GetTestSpace());
   }
 
-  std::unique_ptr<hypre::HypreCSRMatrix> FullAssemble(bool skip_zeros) const
-  {
-    return FullAssemble(*PartialAssemble(), skip_zeros, false);
-  }
+  // Full assembly of square operators caches the sparsity pattern on the finite element
+  // space, so that later assemblies of operators with the same integrators on the same
+  // space only compute the values.
+  std::unique_ptr<hypre::HypreCSRMatrix> FullAssemble(bool skip_zeros) const;
 
   static std::unique_ptr<hypre::HypreCSRMatrix> FullAssemble(const ceed::Operator &op,
                                                              bool skip_zeros)
@@ -81,8 +83,9 @@ public:
     return FullAssemble(op, skip_zeros, false);
   }
 
-  static std::unique_ptr<hypre::HypreCSRMatrix> FullAssemble(const ceed::Operator &op,
-                                                             bool skip_zeros, bool set);
+  static std::unique_ptr<hypre::HypreCSRMatrix>
+  FullAssemble(const ceed::Operator &op, bool skip_zeros, bool set,
+               ceed::AssemblyPlanMap *plans = nullptr);
 
   std::unique_ptr<Operator> Assemble(bool skip_zeros) const;
 
@@ -121,6 +121,7 @@ void FiniteElementSpace::ResetCeedObjects()
   restr.clear();
   interp_restr.clear();
   interp_range_restr.clear();
+  assembly_plans.clear();
   for (std::size_t i = 0; i < ceed::internal::GetCeedObjects().size(); i++)
   {
     Ceed ceed = ceed::internal::GetCeedObjects()[i];
@@ -128,6 +129,7 @@ void FiniteElementSpace::ResetCeedObjects()
     restr.emplace(ceed, ceed::GeometryObjectMap<CeedElemRestriction>());
     interp_restr.emplace(ceed, ceed::GeometryObjectMap<CeedElemRestriction>());
     interp_range_restr.emplace(ceed, ceed::GeometryObjectMap<CeedElemRestriction>());
+    assembly_plans.emplace(ceed, std::vector<ceed::AssemblyPlan>());
   }
 }
 
@@ -30,6 +30,7 @@ private:
   // Members for constructing libCEED operators.
   mutable ceed::CeedObjectMap<CeedBasis> basis;
   mutable ceed::CeedObjectMap<CeedElemRestriction> restr, interp_restr, interp_range_restr;
+  mutable ceed::AssemblyPlanMap assembly_plans;
 
   // Temporary storage for operator applications.
   mutable ComplexVector tx, lx, ly;
@@ -116,8 +117,12 @@ public:
   GetInterpRangeCeedElemRestriction(Ceed ceed, mfem::Geometry::Type geom,
                                     const std::vector<int> &indices) const;
 
+  // Return the cached sparsity patterns for full assembly of square operators on this
+  // space. These are keyed on the element restrictions owned by the space.
+  ceed::AssemblyPlanMap &GetCeedAssemblyPlans() const { return assembly_plans; }
+
   // Clear the cached basis and element restriction objects owned by the finite element
-  // space.
+  // space, along with any cached assembly sparsity patterns.
   void ResetCeedObjects();
 
   void Update() { ResetCeedObjects(); }
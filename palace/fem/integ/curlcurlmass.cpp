@@ -21,6 +21,7 @@ void CurlCurlMassIntegrator::Assemble(Ceed ceed, CeedElemRestriction trial_restr
 {
   CeedQFunctionInfo info;
   info.assemble_q_data = assemble_q_data;
+  info.q_data_single = q_data_single;
 
   // Set up QFunctions.
   CeedInt dim, space_dim, trial_num_comp, test_num_comp;
@@ -22,6 +22,7 @@ void DiffusionMassIntegrator::Assemble(Ceed ceed, CeedElemRestriction trial_rest
 {
   CeedQFunctionInfo info;
   info.assemble_q_data = assemble_q_data;
+  info.q_data_single = q_data_single;
 
   // Set up QFunctions.
   CeedInt dim, space_dim, trial_num_comp, test_num_comp;
@@ -20,6 +20,7 @@ void DivDivIntegrator::Assemble(Ceed ceed, CeedElemRestriction trial_restr,
 {
   CeedQFunctionInfo info;
   info.assemble_q_data = assemble_q_data;
+  info.q_data_single = q_data_single;
 
   // Set up QFunctions.
   CeedInt trial_num_comp, test_num_comp;
@@ -40,15 +40,15 @@ class BilinearFormIntegrator
 {
 protected:
   const MaterialPropertyCoefficient *Q;
-  bool assemble_q_data;
+  bool assemble_q_data, q_data_single;
 
 public:
   BilinearFormIntegrator(const MaterialPropertyCoefficient *Q = nullptr)
-    : Q(Q), assemble_q_data(false)
+    : Q(Q), assemble_q_data(false), q_data_single(false)
   {
   }
   BilinearFormIntegrator(const MaterialPropertyCoefficient &Q)
-    : Q(&Q), assemble_q_data(false)
+    : Q(&Q), assemble_q_data(false), q_data_single(false)
   {
   }
   virtual ~BilinearFormIntegrator() = default;
@@ -60,7 +60,11 @@ public:
 
   virtual void SetMapTypes(int trial_type, int test_type) {}
 
-  void AssembleQuadratureData() { assemble_q_data = true; }
+  void AssembleQuadratureData(bool single = false)
+  {
+    assemble_q_data = true;
+    q_data_single = single;
+  }
 };
 
 // Integrator for a(u, v) = (Q u, v) for H1 elements (also for vector (H1)ᵈ spaces).
@@ -44,6 +44,17 @@ using GeometryObjectMap = std::unordered_map<mfem::Geometry::Type, T>;
 template <typename T>
 using CeedObjectMap = std::unordered_map<Ceed, GeometryObjectMap<T>>;
 
+// Sparsity pattern and COO to CSR mapping for the full assembly of an operator, which is
+// reused to assemble only the values for operators with the same structure (the same active
+// element restriction for each sub-operator).
+struct AssemblyPlan
+{
+  std::vector<CeedElemRestriction> restr;
+  CeedSize nnz;
+  mfem::Array<int> I, J, perm, Jmap;
+};
+using AssemblyPlanMap = std::unordered_map<Ceed, std::vector<AssemblyPlan>>;
+
 // Call libCEED's CeedInit for the given resource. The specific device to use is set prior
 // to this using mfem::Device.
 void Initialize(const char *resource, const char *jit_source_dir);
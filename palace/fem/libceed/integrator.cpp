@@ -157,7 +157,7 @@ void AddOperatorActiveOutputFields(unsigned int ops, Ceed ceed, CeedElemRestrict
 
 std::vector<CeedInt> QuadratureDataSetup(unsigned int ops, Ceed ceed,
                                          CeedElemRestriction restr, CeedBasis basis,
-                                         CeedVector *q_data,
+                                         bool single, CeedVector *q_data,
                                          CeedElemRestriction *q_data_restr)
 {
   // Operator application at each quadrature point should be square, so just use the inputs
@@ -207,27 +207,157 @@ std::vector<CeedInt> QuadratureDataSetup(unsigned int ops, Ceed ceed,
     q_data_size += size * (size + 1) / 2;
   }
 
-  PalaceCeedCall(
-      ceed, CeedVectorCreate(ceed, (CeedSize)num_elem * num_qpts * q_data_size, q_data));
-  PalaceCeedCall(
-      ceed, CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, q_data_size,
-                                             (CeedSize)num_elem * num_qpts * q_data_size,
-                                             CEED_STRIDES_BACKEND, q_data_restr));
+  // Quadrature data to be converted to single precision after assembly uses a known layout,
+  // and storage owned by the caller so that the conversion can be performed in place.
+  const CeedSize q_data_len = (CeedSize)num_elem * num_qpts * q_data_size;
+  PalaceCeedCall(ceed, CeedVectorCreate(ceed, q_data_len, q_data));
+  if (single)
+  {
+    CeedScalar *d;
+    PalaceCeedCall(ceed, CeedCalloc(q_data_len, &d));
+    PalaceCeedCall(ceed, CeedVectorSetArray(*q_data, CEED_MEM_HOST, CEED_USE_POINTER, d));
+    const CeedInt strides[3] = {1, num_qpts, num_qpts * q_data_size};
+    PalaceCeedCall(ceed,
+                   CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, q_data_size,
+                                                    q_data_len, strides, q_data_restr));
+  }
+  else
+  {
+    PalaceCeedCall(ceed, CeedElemRestrictionCreateStrided(
+                             ceed, num_elem, num_qpts, q_data_size, q_data_len,
+                             CEED_STRIDES_BACKEND, q_data_restr));
+  }
 
   return active_input_sizes;
 }
 
+void QuadratureDataConvertSingle(Ceed ceed, CeedVector *q_data,
+                                 CeedElemRestriction *q_data_restr)
+{
+  // Round the assembled quadrature data to single precision, packing two components into
+  // each CeedScalar (see fem/qfunctions/apply/apply_single_qf.h). The packed data replaces
+  // the double precision data in the same storage, which is then shrunk, so no second copy
+  // of the quadrature data is allocated. Each packed entry is written at or before the
+  // position of the first component it is read from, so a forward sweep is safe.
+  static_assert(sizeof(CeedScalarSingle) == sizeof(CeedScalar),
+                "Unexpected size for packed single precision quadrature data!");
+  CeedInt num_elem, num_qpts, q_data_size;
+  PalaceCeedCall(ceed, CeedElemRestrictionGetNumElements(*q_data_restr, &num_elem));
+  PalaceCeedCall(ceed, CeedElemRestrictionGetElementSize(*q_data_restr, &num_qpts));
+  PalaceCeedCall(ceed, CeedElemRestrictionGetNumComponents(*q_data_restr, &q_data_size));
+  const CeedInt q_data_size_single = (q_data_size + 1) / 2;
+  const CeedSize q_data_len_single = (CeedSize)num_elem * num_qpts * q_data_size_single;
+  CeedScalar *d;
+  PalaceCeedCall(ceed, CeedVectorTakeArray(*q_data, CEED_MEM_HOST, &d));
+  PalaceCeedCall(ceed, CeedVectorDestroy(q_data));
+  PalaceCeedCall(ceed, CeedElemRestrictionDestroy(q_data_restr));
+  for (CeedInt e = 0; e < num_elem; e++)
+  {
+    const CeedScalar *d_e = d + (std::size_t)e * num_qpts * q_data_size;
+    CeedScalar *d_single_e = d + (std::size_t)e * num_qpts * q_data_size_single;
+    for (CeedInt c = 0; c < q_data_size_single; c++)
+    {
+      for (CeedInt i = 0; i < num_qpts; i++)
+      {
+        CeedScalarSingle d_loc;
+        d_loc.unpacked[0] = static_cast<float>(d_e[i + num_qpts * (2 * c)]);
+        d_loc.unpacked[1] = (2 * c + 1 < q_data_size)
+                                ? static_cast<float>(d_e[i + num_qpts * (2 * c + 1)])
+                                : 0.0f;
+        d_single_e[i + num_qpts * c] = d_loc.packed;
+      }
+    }
+  }
+  PalaceCeedCall(ceed, CeedRealloc(q_data_len_single, &d));
+
+  PalaceCeedCall(ceed, CeedVectorCreate(ceed, q_data_len_single, q_data));
+  PalaceCeedCall(ceed, CeedVectorSetArray(*q_data, CEED_MEM_HOST, CEED_OWN_POINTER, d));
+  const CeedInt strides[3] = {1, num_qpts, num_qpts * q_data_size_single};
+  PalaceCeedCall(ceed, CeedElemRestrictionCreateStrided(
+                           ceed, num_elem, num_qpts, q_data_size_single,
+                           q_data_len_single, strides, q_data_restr));
+}
+
+void GetGeometryDataBasis(Ceed ceed, CeedElemRestriction geom_data_restr, CeedBasis basis,
+                          CeedBasis *geom_data_basis)
+{
+  // Geometry factor data for affine elements is stored once per element (see
+  // AssembleGeometryData in fem/mesh.cpp) and is expanded to quadrature points using a
+  // basis with interpolation matrix [1, w_q]. Otherwise, the data is already stored at
+  // quadrature points and no basis is required.
+  CeedInt num_qpts, geom_data_elem_size, geom_data_size;
+  PalaceCeedCall(ceed, CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  PalaceCeedCall(ceed,
+                 CeedElemRestrictionGetElementSize(geom_data_restr, &geom_data_elem_size));
+  if (geom_data_elem_size == num_qpts)
+  {
+    *geom_data_basis = CEED_BASIS_NONE;
+    return;
+  }
+  MFEM_VERIFY(geom_data_elem_size == 2,
+              "Invalid element size for compressed geometry factor data ("
+                  << geom_data_elem_size << ")!");
+  PalaceCeedCall(ceed,
+                 CeedElemRestrictionGetNumComponents(geom_data_restr, &geom_data_size));
+  const CeedScalar *qw;
+  PalaceCeedCall(ceed, CeedBasisGetQWeights(basis, &qw));
+
+  // Note: ceed::GetCeedTopology(CEED_TOPOLOGY_LINE) == 1.
+  mfem::Vector Bt(2 * num_qpts), Gt(2 * num_qpts), qX(num_qpts), qW(num_qpts);
+  for (CeedInt q = 0; q < num_qpts; q++)
+  {
+    Bt(2 * q + 0) = 1.0;
+    Bt(2 * q + 1) = qw[q];
+    qW(q) = qw[q];
+  }
+  Gt = 0.0;
+  qX = 0.0;
+  PalaceCeedCall(ceed, CeedBasisCreateH1(ceed, CEED_TOPOLOGY_LINE, geom_data_size, 2,
+                                         num_qpts, Bt.GetData(), Gt.GetData(), qX.GetData(),
+                                         qW.GetData(), geom_data_basis));
+}
+
+void AddQFunctionGeometryDataInput(Ceed ceed, CeedElemRestriction geom_data_restr,
+                                   CeedBasis geom_data_basis, CeedQFunction qf)
+{
+  CeedInt geom_data_size;
+  PalaceCeedCall(ceed,
+                 CeedElemRestrictionGetNumComponents(geom_data_restr, &geom_data_size));
+  PalaceCeedCall(ceed, CeedQFunctionAddInput(qf, "geom_data", geom_data_size,
+                                             (geom_data_basis == CEED_BASIS_NONE)
+                                                 ? CEED_EVAL_NONE
+                                                 : CEED_EVAL_INTERP));
+}
+
+void AddOperatorGeometryDataField(Ceed ceed, CeedElemRestriction geom_data_restr,
+                                  CeedBasis geom_data_basis, CeedVector geom_data,
+                                  CeedOperator op)
+{
+  PalaceCeedCall(ceed, CeedOperatorSetField(op, "geom_data", geom_data_restr,
+                                            geom_data_basis, geom_data));
+  if (geom_data_basis != CEED_BASIS_NONE)
+  {
+    // The basis is now owned by the operator.
+    PalaceCeedCall(ceed, CeedBasisDestroy(&geom_data_basis));
+  }
+}
+
 void QuadratureDataAssembly(const std::vector<CeedInt> &qf_active_sizes,
                             const CeedQFunctionInfo &info, Ceed ceed,
                             CeedElemRestriction trial_restr, CeedElemRestriction test_restr,
-                            CeedBasis trial_basis, CeedBasis test_basis, CeedVector q_data,
-                            CeedElemRestriction q_data_restr, CeedOperator *op)
+                            CeedBasis trial_basis, CeedBasis test_basis,
+                            CeedVector *q_data, CeedElemRestriction *q_data_restr,
+                            CeedOperator *op)
 {
   // Assemble the quadrature data, destroy the operator, and create a new one for the
   // actual operator application.
   PalaceCeedCall(ceed,
-                 CeedOperatorApply(*op, CEED_VECTOR_NONE, q_data, CEED_REQUEST_IMMEDIATE));
+                 CeedOperatorApply(*op, CEED_VECTOR_NONE, *q_data, CEED_REQUEST_IMMEDIATE));
   PalaceCeedCall(ceed, CeedOperatorDestroy(op));
+  if (info.q_data_single)
+  {
+    QuadratureDataConvertSingle(ceed, q_data, q_data_restr);
+  }
 
   MFEM_VERIFY(!qf_active_sizes.empty() && qf_active_sizes.size() <= 2,
               "Invalid number of active QFunction input/output fields ("
@@ -239,51 +369,105 @@ void QuadratureDataAssembly(const std::vector<CeedInt> &qf_active_sizes,
   {
     case 1:
     case 10:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_1,
-                               PalaceQFunctionRelativePath(f_apply_1_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_1,
+                                     PalaceQFunctionRelativePath(f_apply_single_1_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_1,
+                                     PalaceQFunctionRelativePath(f_apply_1_loc),
+                                     &apply_qf));
       break;
     case 2:
     case 20:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_2,
-                               PalaceQFunctionRelativePath(f_apply_2_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_2,
+                                     PalaceQFunctionRelativePath(f_apply_single_2_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_2,
+                                     PalaceQFunctionRelativePath(f_apply_2_loc),
+                                     &apply_qf));
       break;
     case 3:
     case 30:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_3,
-                               PalaceQFunctionRelativePath(f_apply_3_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_3,
+                                     PalaceQFunctionRelativePath(f_apply_single_3_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_3,
+                                     PalaceQFunctionRelativePath(f_apply_3_loc),
+                                     &apply_qf));
       break;
     case 22:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_22,
-                               PalaceQFunctionRelativePath(f_apply_22_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_22,
+                                     PalaceQFunctionRelativePath(f_apply_single_22_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_22,
+                                     PalaceQFunctionRelativePath(f_apply_22_loc),
+                                     &apply_qf));
       break;
     case 33:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_33,
-                               PalaceQFunctionRelativePath(f_apply_33_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_33,
+                                     PalaceQFunctionRelativePath(f_apply_single_33_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_33,
+                                     PalaceQFunctionRelativePath(f_apply_33_loc),
+                                     &apply_qf));
       break;
     case 12:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_12,
-                               PalaceQFunctionRelativePath(f_apply_12_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_12,
+                                     PalaceQFunctionRelativePath(f_apply_single_12_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_12,
+                                     PalaceQFunctionRelativePath(f_apply_12_loc),
+                                     &apply_qf));
       break;
     case 13:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_13,
-                               PalaceQFunctionRelativePath(f_apply_13_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_13,
+                                     PalaceQFunctionRelativePath(f_apply_single_13_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_13,
+                                     PalaceQFunctionRelativePath(f_apply_13_loc),
+                                     &apply_qf));
       break;
     case 21:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_21,
-                               PalaceQFunctionRelativePath(f_apply_21_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_21,
+                                     PalaceQFunctionRelativePath(f_apply_single_21_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_21,
+                                     PalaceQFunctionRelativePath(f_apply_21_loc),
+                                     &apply_qf));
       break;
     case 31:
-      PalaceCeedCall(ceed, CeedQFunctionCreateInterior(
-                               ceed, 1, f_apply_31,
-                               PalaceQFunctionRelativePath(f_apply_31_loc), &apply_qf));
+      PalaceCeedCall(ceed, info.q_data_single
+                               ? CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_single_31,
+                                     PalaceQFunctionRelativePath(f_apply_single_31_loc),
+                                     &apply_qf)
+                               : CeedQFunctionCreateInterior(
+                                     ceed, 1, f_apply_31,
+                                     PalaceQFunctionRelativePath(f_apply_31_loc),
+                                     &apply_qf));
       break;
     default:
       MFEM_ABORT("Invalid number of QFunction input/output components ("
@@ -294,7 +478,7 @@ void QuadratureDataAssembly(const std::vector<CeedInt> &qf_active_sizes,
   // Inputs/outputs.
   {
     CeedInt q_data_size;
-    PalaceCeedCall(ceed, CeedElemRestrictionGetNumComponents(q_data_restr, &q_data_size));
+    PalaceCeedCall(ceed, CeedElemRestrictionGetNumComponents(*q_data_restr, &q_data_size));
     PalaceCeedCall(ceed,
                    CeedQFunctionAddInput(apply_qf, "q_data", q_data_size, CEED_EVAL_NONE));
   }
@@ -306,7 +490,7 @@ void QuadratureDataAssembly(const std::vector<CeedInt> &qf_active_sizes,
   PalaceCeedCall(ceed, CeedQFunctionDestroy(&apply_qf));
 
   PalaceCeedCall(
-      ceed, CeedOperatorSetField(*op, "q_data", q_data_restr, CEED_BASIS_NONE, q_data));
+      ceed, CeedOperatorSetField(*op, "q_data", *q_data_restr, CEED_BASIS_NONE, *q_data));
   AddOperatorActiveInputFields(info.trial_ops, ceed, trial_restr, trial_basis, *op);
   AddOperatorActiveOutputFields(info.test_ops, ceed, test_restr, test_basis, *op);
 
@@ -427,8 +611,9 @@ void AssembleCeedOperator(const CeedQFunctionInfo &info, void *ctx, std::size_t
   std::vector<CeedInt> qf_active_sizes;
   if (info.assemble_q_data)
   {
-    qf_active_sizes = QuadratureDataSetup(info.trial_ops, ceed, trial_restr, trial_basis,
-                                          &q_data, &q_data_restr);
+    qf_active_sizes =
+        QuadratureDataSetup(info.trial_ops, ceed, trial_restr, trial_basis,
+                            info.q_data_single, &q_data, &q_data_restr);
   }
 
   // Create the QFunction that defines the action of the operator (or its setup).
@@ -444,13 +629,9 @@ void AssembleCeedOperator(const CeedQFunctionInfo &info, void *ctx, std::size_t
   PalaceCeedCall(ceed, CeedQFunctionContextDestroy(&apply_ctx));
 
   // Inputs/outputs.
-  {
-    CeedInt geom_data_size;
-    PalaceCeedCall(ceed,
-                   CeedElemRestrictionGetNumComponents(geom_data_restr, &geom_data_size));
-    PalaceCeedCall(
-        ceed, CeedQFunctionAddInput(apply_qf, "geom_data", geom_data_size, CEED_EVAL_NONE));
-  }
+  CeedBasis geom_data_basis;
+  GetGeometryDataBasis(ceed, geom_data_restr, trial_basis, &geom_data_basis);
+  AddQFunctionGeometryDataInput(ceed, geom_data_restr, geom_data_basis, apply_qf);
   if (info.trial_ops & EvalMode::Weight)
   {
     PalaceCeedCall(ceed, CeedQFunctionAddInput(apply_qf, "q_w", 1, CEED_EVAL_WEIGHT));
@@ -474,8 +655,7 @@ void AssembleCeedOperator(const CeedQFunctionInfo &info, void *ctx, std::size_t
   PalaceCeedCall(ceed, CeedOperatorCreate(ceed, apply_qf, nullptr, nullptr, op));
   PalaceCeedCall(ceed, CeedQFunctionDestroy(&apply_qf));
 
-  PalaceCeedCall(ceed, CeedOperatorSetField(*op, "geom_data", geom_data_restr,
-                                            CEED_BASIS_NONE, geom_data));
+  AddOperatorGeometryDataField(ceed, geom_data_restr, geom_data_basis, geom_data, *op);
   if (info.trial_ops & EvalMode::Weight)
   {
     PalaceCeedCall(ceed, CeedOperatorSetField(*op, "q_w", CEED_ELEMRESTRICTION_NONE,
@@ -498,7 +678,7 @@ void AssembleCeedOperator(const CeedQFunctionInfo &info, void *ctx, std::size_t
   if (info.assemble_q_data)
   {
     QuadratureDataAssembly(qf_active_sizes, info, ceed, trial_restr, test_restr,
-                           trial_basis, test_basis, q_data, q_data_restr, op);
+                           trial_basis, test_basis, &q_data, &q_data_restr, op);
 
     // Cleanup (these are now owned by the operator).
     PalaceCeedCall(ceed, CeedElemRestrictionDestroy(&q_data_restr));
@@ -582,13 +762,9 @@ void AssembleCeedElementErrorIntegrator(
   PalaceCeedCall(ceed, CeedQFunctionContextDestroy(&apply_ctx));
 
   // Inputs/outputs. "Test" operations are the operations for the second input vector.
-  {
-    CeedInt geom_data_size;
-    PalaceCeedCall(ceed,
-                   CeedElemRestrictionGetNumComponents(geom_data_restr, &geom_data_size));
-    PalaceCeedCall(
-        ceed, CeedQFunctionAddInput(apply_qf, "geom_data", geom_data_size, CEED_EVAL_NONE));
-  }
+  CeedBasis geom_data_basis;
+  GetGeometryDataBasis(ceed, geom_data_restr, input1_basis, &geom_data_basis);
+  AddQFunctionGeometryDataInput(ceed, geom_data_restr, geom_data_basis, apply_qf);
   if (info.trial_ops & EvalMode::Weight)
   {
     PalaceCeedCall(ceed, CeedQFunctionAddInput(apply_qf, "q_w", 1, CEED_EVAL_WEIGHT));
@@ -602,8 +778,7 @@ void AssembleCeedElementErrorIntegrator(
   PalaceCeedCall(ceed, CeedOperatorCreate(ceed, apply_qf, nullptr, nullptr, op));
   PalaceCeedCall(ceed, CeedQFunctionDestroy(&apply_qf));
 
-  PalaceCeedCall(ceed, CeedOperatorSetField(*op, "geom_data", geom_data_restr,
-                                            CEED_BASIS_NONE, geom_data));
+  AddOperatorGeometryDataField(ceed, geom_data_restr, geom_data_basis, geom_data, *op);
   if (info.trial_ops & EvalMode::Weight)
   {
     PalaceCeedCall(ceed, CeedOperatorSetField(*op, "q_w", CEED_ELEMRESTRICTION_NONE,
@@ -38,9 +38,14 @@ struct CeedQFunctionInfo
   // operator application in true matrix-free fashion.
   bool assemble_q_data;
 
+  // Store the pre-assembled quadrature data in single precision, to reduce the memory
+  // traffic of operator application for operators which only need to be approximate (for
+  // example, for preconditioning).
+  bool q_data_single;
+
   CeedQFunctionInfo()
     : apply_qf(nullptr), apply_qf_path(""), trial_ops(0), test_ops(0),
-      assemble_q_data(false)
+      assemble_q_data(false), q_data_single(false)
   {
   }
 };
@@ -3,6 +3,7 @@
 
 #include "operator.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <ceed/backend.h>
 #include <mfem.hpp>
@@ -10,11 +11,12 @@
 #include "fem/fespace.hpp"
 #include "linalg/hypre.hpp"
 #include "utils/omp.hpp"
+#include "utils/profiler.hpp"
 
 namespace palace::ceed
 {
 
-Operator::Operator(int h, int w) : palace::Operator(h, w)
+Operator::Operator(int h, int w) : palace::Operator(h, w), flops(0.0), flops_t(0.0)
 {
   const std::size_t nt = internal::GetCeedObjects().size();
   op.resize(nt, nullptr);
@@ -88,6 +90,7 @@ void Operator::AddOper(CeedOperator sub_op, CeedOperator sub_op_t)
 
 void Operator::Finalize()
 {
+  std::vector<CeedSize> loc_flops(op.size(), 0), loc_flops_t(op.size(), 0);
   PalacePragmaOmp(parallel if (op.size() > 1))
   {
     const int id = utils::GetThreadNum();
@@ -97,7 +100,20 @@ void Operator::Finalize()
     PalaceCeedCallBackend(CeedOperatorGetCeed(op[id], &ceed));
     PalaceCeedCall(ceed, CeedOperatorCheckReady(op[id]));
     PalaceCeedCall(ceed, CeedOperatorCheckReady(op_t[id]));
+    PalaceCeedCall(ceed, CeedOperatorGetFlopsEstimate(op[id], &loc_flops[id]));
+    PalaceCeedCall(ceed, CeedOperatorGetFlopsEstimate(op_t[id], &loc_flops_t[id]));
   }
+  flops = std::accumulate(loc_flops.begin(), loc_flops.end(), 0.0);
+  flops_t = std::accumulate(loc_flops_t.begin(), loc_flops_t.end(), 0.0);
+}
+
+void Operator::AddProfilerCounters(bool transpose) const
+{
+  // The memory traffic estimate only accounts for reading the input vector and updating the
+  // output vector, and not any quadrature data or element restriction offsets.
+  const double bytes = (transpose ? (height + 2.0 * width) : (width + 2.0 * height)) *
+                       sizeof(CeedScalar);
+  Profiler::AddCounters(transpose ? flops_t : flops, bytes);
 }
 
 void Operator::AssembleDiagonal(Vector &diag) const
@@ -169,6 +185,7 @@ void Operator::Mult(const Vector &x, Vector &y) const
 {
   y = 0.0;
   CeedAddMult(op, u, v, x, y);
+  AddProfilerCounters(false);
   if (dof_multiplicity.Size() > 0)
   {
     y *= dof_multiplicity;
@@ -178,6 +195,7 @@ void Operator::Mult(const Vector &x, Vector &y) const
 void Operator::AddMult(const Vector &x, Vector &y, const double a) const
 {
   MFEM_VERIFY(a == 1.0, "ceed::Operator::AddMult only supports coefficient = 1.0!");
+  AddProfilerCounters(false);
   if (dof_multiplicity.Size() > 0)
   {
     temp.SetSize(height);
@@ -207,6 +225,7 @@ void Operator::AddMultTranspose(const Vector &x, Vector &y, const double a) cons
 {
   MFEM_VERIFY(a == 1.0,
               "ceed::Operator::AddMultTranspose only supports coefficient = 1.0!");
+  AddProfilerCounters(true);
   if (dof_multiplicity.Size() > 0)
   {
     temp.SetSize(height);
@@ -302,15 +321,18 @@ void CeedOperatorAssembleCOO(Ceed ceed, CeedOperator op, bool skip_zeros, CeedSi
   // std::cout << "\n";
 }
 
-std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSR(Ceed ceed, CeedInt m, CeedInt n,
-                                                        CeedSize nnz, CeedInt *rows,
-                                                        CeedInt *cols, CeedVector vals,
-                                                        CeedMemType mem, bool set)
+void OperatorCOOtoCSRPattern(Ceed ceed, CeedInt m, CeedSize nnz, CeedInt *rows,
+                             CeedInt *cols, AssemblyPlan &plan)
 {
   // Preallocate CSR memory on host (like PETSc's MatSetValuesCOO). Check for overflow for
   // large nonzero counts.
   const int nnz_int = mfem::internal::to_int(nnz);
-  mfem::Array<int> I(m + 1), J(nnz_int), perm(nnz_int), Jmap(nnz_int + 1);
+  auto &I = plan.I, &J = plan.J, &perm = plan.perm, &Jmap = plan.Jmap;
+  plan.nnz = nnz;
+  I.SetSize(m + 1);
+  J.SetSize(nnz_int);
+  perm.SetSize(nnz_int);
+  Jmap.SetSize(nnz_int + 1);
   I = 0;
   for (int k = 0; k < nnz_int; k++)
   {
@@ -367,9 +389,19 @@ std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSR(Ceed ceed, CeedInt m, Ce
   {
     Jmap[k + 1] += Jmap[k];
   }
+  J.SetSize(nnz_new);
+  Jmap.SetSize(nnz_new + 1);
+}
 
+std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSRValues(CeedInt m, CeedInt n,
+                                                              const AssemblyPlan &plan,
+                                                              CeedVector vals,
+                                                              CeedMemType mem, bool set)
+{
   // Construct and fill the final CSR matrix. On GPU, MFEM and Hypre share the same memory
   // space. On CPU, the inner nested OpenMP loop (if enabled in MFEM) should be ignored.
+  const auto &I = plan.I, &J = plan.J, &perm = plan.perm, &Jmap = plan.Jmap;
+  const int nnz_int = mfem::internal::to_int(plan.nnz), nnz_new = J.Size();
   auto mat = std::make_unique<hypre::HypreCSRMatrix>(m, n, nnz_new);
   {
     const auto *d_I_old = I.Read();
@@ -436,12 +468,31 @@ std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSR(Ceed ceed, CeedInt m, Ce
   return mat;
 }
 
+std::vector<CeedElemRestriction> GetAssemblyPlanKey(Ceed ceed, CeedOperator op)
+{
+  // The sparsity pattern of the assembled operator depends only on the active element
+  // restriction for each of the sub-operators (square operators only).
+  CeedInt nsub_ops;
+  CeedOperator *sub_ops;
+  PalaceCeedCall(ceed, CeedCompositeOperatorGetNumSub(op, &nsub_ops));
+  PalaceCeedCall(ceed, CeedCompositeOperatorGetSubList(op, &sub_ops));
+  std::vector<CeedElemRestriction> key(nsub_ops);
+  for (CeedInt k = 0; k < nsub_ops; k++)
+  {
+    PalaceCeedCall(ceed, CeedOperatorGetActiveElemRestriction(sub_ops[k], &key[k]));
+  }
+  return key;
+}
+
 }  // namespace
 
-std::unique_ptr<hypre::HypreCSRMatrix> CeedOperatorFullAssemble(const Operator &op,
-                                                                bool skip_zeros, bool set)
+std::unique_ptr<hypre::HypreCSRMatrix>
+CeedOperatorFullAssemble(const Operator &op, bool skip_zeros, bool set,
+                         AssemblyPlanMap *plans)
 {
   // Assemble operators on each thread.
+  MFEM_VERIFY(!plans || op.Height() == op.Width(),
+              "Cached assembly sparsity patterns are only available for square operators!");
   std::vector<std::unique_ptr<hypre::HypreCSRMatrix>> loc_mat(op.Size());
   PalacePragmaOmp(parallel if (op.Size() > 1))
   {
@@ -460,17 +511,45 @@ std::unique_ptr<hypre::HypreCSRMatrix> CeedOperatorFullAssemble(const Operator &
     }
     else
     {
-      // First, get matrix on master thread in COO format, withs rows/cols always on host
-      // and vals potentially on the device. Process skipping zeros if desired.
-      CeedSize nnz;
-      CeedInt *rows, *cols;
+      // Look for an existing sparsity pattern for an operator with the same structure. The
+      // pattern cannot be reused when skipping zeros, since it depends on the values.
+      AssemblyPlan loc_plan, *plan = nullptr;
+      std::vector<AssemblyPlan> *loc_plans = nullptr;
+      std::vector<CeedElemRestriction> key;
+      if (plans && !skip_zeros && plans->find(ceed) != plans->end())
+      {
+        loc_plans = &plans->at(ceed);
+        key = GetAssemblyPlanKey(ceed, op[id]);
+        auto it = std::find_if(loc_plans->begin(), loc_plans->end(),
+                               [&key](const AssemblyPlan &p) { return p.restr == key; });
+        plan = (it != loc_plans->end()) ? &(*it) : nullptr;
+      }
       CeedVector vals;
       CeedMemType mem;
-      CeedOperatorAssembleCOO(ceed, op[id], skip_zeros, &nnz, &rows, &cols, &vals, &mem);
+      if (plan)
+      {
+        // Reassemble the values only.
+        PalaceCeedCall(ceed, CeedGetPreferredMemType(ceed, &mem));
+        PalaceCeedCall(ceed, CeedVectorCreate(ceed, plan->nnz, &vals));
+        PalaceCeedCall(ceed, CeedOperatorLinearAssemble(op[id], vals));
+      }
+      else
+      {
+        // First, get matrix on master thread in COO format, withs rows/cols always on host
+        // and vals potentially on the device. Process skipping zeros if desired.
+        CeedSize nnz;
+        CeedInt *rows, *cols;
+        CeedOperatorAssembleCOO(ceed, op[id], skip_zeros, &nnz, &rows, &cols, &vals, &mem);
+
+        // Compute the COO to CSR mapping (on each thread). The COO memory is free'd
+        // internally.
+        plan = loc_plans ? &loc_plans->emplace_back() : &loc_plan;
+        plan->restr = std::move(key);
+        OperatorCOOtoCSRPattern(ceed, op.Height(), nnz, rows, cols, *plan);
+      }
 
-      // Convert COO to CSR (on each thread). The COO memory is free'd internally.
-      loc_mat[id] =
-          OperatorCOOtoCSR(ceed, op.Height(), op.Width(), nnz, rows, cols, vals, mem, set);
+      // Convert COO to CSR values (on each thread).
+      loc_mat[id] = OperatorCOOtoCSRValues(op.Height(), op.Width(), *plan, vals, mem, set);
     }
   }
 
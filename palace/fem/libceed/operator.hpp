@@ -37,6 +37,12 @@ protected:
   Vector dof_multiplicity;
   mutable Vector temp;
 
+  // Estimated floating point operations for a single application of the operator and its
+  // transpose, reported to the profiler with each application.
+  double flops, flops_t;
+
+  void AddProfilerCounters(bool transpose) const;
+
 public:
   Operator(int h, int w);
   ~Operator() override;
@@ -75,9 +81,12 @@ public:
   }
 };
 
-// Assemble a ceed::Operator as a CSR matrix.
-std::unique_ptr<hypre::HypreCSRMatrix> CeedOperatorFullAssemble(const Operator &op,
-                                                                bool skip_zeros, bool set);
+// Assemble a ceed::Operator as a CSR matrix. For square operators, the sparsity pattern and
+// COO to CSR mapping can be cached in plans, so that later assemblies of operators with the
+// same structure only compute the values (not used when skipping zeros).
+std::unique_ptr<hypre::HypreCSRMatrix>
+CeedOperatorFullAssemble(const Operator &op, bool skip_zeros, bool set,
+                         AssemblyPlanMap *plans = nullptr);
 
 // Construct a coarse-level ceed::Operator, reusing the quadrature data and quadrature
 // function from the fine-level operator. Only available for square, symmetric operators
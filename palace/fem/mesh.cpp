@@ -3,6 +3,7 @@
 
 #include "mesh.hpp"
 
+#include <ceed/backend.h>
 #include "fem/coefficient.hpp"
 #include "fem/fespace.hpp"
 #include "fem/libceed/integrator.hpp"
@@ -183,15 +184,71 @@ auto AssembleGeometryData(Ceed ceed, mfem::Geometry::Type geom, std::vector<int>
   PalaceCeedCall(ceed,
                  CeedVectorCreate(ceed, (CeedSize)num_elem * num_qpts * geom_data_size,
                                   &data.geom_data));
-  PalaceCeedCall(
-      ceed, CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, geom_data_size,
-                                             (CeedSize)num_elem * num_qpts * geom_data_size,
-                                             CEED_STRIDES_BACKEND, &data.geom_data_restr));
+
+  // Simplex elements with straight sides have a constant Jacobian, so the geometry factor
+  // data is compressed to be stored once per element rather than at every quadrature
+  // point. For this, the data is first computed with a known layout.
+  const bool affine = (geom == mfem::Geometry::TRIANGLE ||
+                       geom == mfem::Geometry::TETRAHEDRON) &&
+                      mesh_fespace.FEColl()->GetOrder() == 1 && num_qpts > 2;
+  if (affine)
+  {
+    const CeedInt strides[3] = {1, num_qpts, num_qpts * geom_data_size};
+    PalaceCeedCall(ceed, CeedElemRestrictionCreateStrided(
+                             ceed, num_elem, num_qpts, geom_data_size,
+                             (CeedSize)num_elem * num_qpts * geom_data_size, strides,
+                             &data.geom_data_restr));
+  }
+  else
+  {
+    PalaceCeedCall(ceed, CeedElemRestrictionCreateStrided(
+                             ceed, num_elem, num_qpts, geom_data_size,
+                             (CeedSize)num_elem * num_qpts * geom_data_size,
+                             CEED_STRIDES_BACKEND, &data.geom_data_restr));
+  }
 
   // Compute the required geometry factors at quadrature points.
   ceed::AssembleCeedGeometryData(ceed, mesh_restr, mesh_basis, mesh_nodes_vec, attr_restr,
                                  attr_basis, elem_attr_vec, data.geom_data,
                                  data.geom_data_restr);
+
+  // For affine elements, keep only the data at the first quadrature point. The compressed
+  // data has two "nodes" per element: the first stores the attribute and adjugate Jacobian,
+  // and the second stores the Jacobian determinant without the quadrature weight. These are
+  // expanded to quadrature points using a basis with interpolation matrix [1, w_q] (see
+  // ceed::AssembleCeedOperator).
+  if (affine)
+  {
+    const CeedScalar *qw, *geom_data_full;
+    PalaceCeedCall(ceed, CeedBasisGetQWeights(mesh_basis, &qw));
+    PalaceCeedCall(ceed,
+                   CeedVectorGetArrayRead(data.geom_data, CEED_MEM_HOST, &geom_data_full));
+    std::vector<CeedScalar> geom_data_affine(num_elem * 2 * geom_data_size, 0.0);
+    for (std::size_t e = 0; e < num_elem; e++)
+    {
+      const CeedScalar *d = geom_data_full + e * num_qpts * geom_data_size;
+      CeedScalar *d_affine = geom_data_affine.data() + e * 2 * geom_data_size;
+      d_affine[0] = d[0];
+      d_affine[2 + 1] = d[num_qpts] / qw[0];
+      for (CeedInt c = 2; c < geom_data_size; c++)
+      {
+        d_affine[2 * c] = d[c * num_qpts];
+      }
+    }
+    PalaceCeedCall(ceed, CeedVectorRestoreArrayRead(data.geom_data, &geom_data_full));
+    PalaceCeedCall(ceed, CeedVectorDestroy(&data.geom_data));
+    PalaceCeedCall(ceed, CeedElemRestrictionDestroy(&data.geom_data_restr));
+
+    const CeedInt strides[3] = {1, 2, 2 * geom_data_size};
+    PalaceCeedCall(ceed, CeedVectorCreate(ceed, (CeedSize)num_elem * 2 * geom_data_size,
+                                          &data.geom_data));
+    PalaceCeedCall(ceed, CeedVectorSetArray(data.geom_data, CEED_MEM_HOST, CEED_COPY_VALUES,
+                                            geom_data_affine.data()));
+    PalaceCeedCall(ceed, CeedElemRestrictionCreateStrided(
+                             ceed, num_elem, 2, geom_data_size,
+                             (CeedSize)num_elem * 2 * geom_data_size, strides,
+                             &data.geom_data_restr));
+  }
   PalaceCeedCall(ceed, CeedVectorDestroy(&mesh_nodes_vec));
   PalaceCeedCall(ceed, CeedElemRestrictionDestroy(&mesh_restr));
   PalaceCeedCall(ceed, CeedBasisDestroy(&mesh_basis));
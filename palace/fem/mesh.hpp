@@ -29,7 +29,9 @@ struct CeedGeomFactorData
   std::vector<int> indices;
 
   // Mesh geometry factor data: {attr, w * |J|, adj(J)^T / |J|}. Jacobian matrix is
-  // space_dim x dim, stored column-major by component.
+  // space_dim x dim, stored column-major by component. For affine elements, the data is
+  // stored once per element instead of at each quadrature point, and the element
+  // restriction has an element size of 2 instead of the number of quadrature points.
   CeedVector geom_data;
 
   // Element restriction for the geometry factor quadrature data.
@@ -0,0 +1,127 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LIBCEED_APPLY_SINGLE_QF_H
+#define PALACE_LIBCEED_APPLY_SINGLE_QF_H
+
+// Quadrature data stored in single precision packs two components into each CeedScalar:
+// component c at quadrature point i is stored in entry c % 2 of the packed component c / 2.
+
+union CeedScalarSingle
+{
+  CeedScalar packed;
+  float unpacked[2];
+};
+
+CEED_QFUNCTION_HELPER CeedScalar QDataUnpackSingle(const CeedScalar *qd, const CeedInt Q,
+                                                   const CeedInt i, const CeedInt c)
+{
+  CeedScalarSingle qd_loc;
+  qd_loc.packed = qd[i + Q * (c / 2)];
+  return (CeedScalar)qd_loc.unpacked[c % 2];
+}
+
+template <int N>
+CEED_QFUNCTION_HELPER void MultSymSingle(const CeedScalar *qd, const CeedInt qd_offset,
+                                         const CeedInt Q, const CeedInt i,
+                                         const CeedScalar *u, CeedScalar *v)
+{
+  // Symmetric matrix stored as upper triangular by rows:
+  //   N = 1: 0      N = 2: 0 1    N = 3: 0 1 2
+  //                        1 2           1 3 4
+  //                                      2 4 5
+  CeedScalar A[N * (N + 1) / 2], u_loc[N];
+  for (CeedInt k = 0; k < N * (N + 1) / 2; k++)
+  {
+    A[k] = QDataUnpackSingle(qd, Q, i, qd_offset + k);
+  }
+  for (CeedInt r = 0; r < N; r++)
+  {
+    u_loc[r] = u[i + Q * r];
+  }
+  for (CeedInt r = 0; r < N; r++)
+  {
+    CeedScalar sum = 0.0;
+    for (CeedInt c = 0; c < N; c++)
+    {
+      const CeedInt rr = (r < c) ? r : c, cc = (r < c) ? c : r;
+      sum += A[rr * N - rr * (rr - 1) / 2 + (cc - rr)] * u_loc[c];
+    }
+    v[i + Q * r] = sum;
+  }
+}
+
+template <int N1, int N2>
+CEED_QFUNCTION_HELPER int ApplySingle(CeedInt Q, const CeedScalar *const *in,
+                                      CeedScalar *const *out)
+{
+  const CeedScalar *__restrict__ qd = in[0], *__restrict__ u1 = in[1],
+                                 *__restrict__ u2 = (N2 > 0) ? in[2] : NULL;
+  CeedScalar *__restrict__ v1 = out[0], *__restrict__ v2 = (N2 > 0) ? out[1] : NULL;
+
+  CeedPragmaSIMD for (CeedInt i = 0; i < Q; i++)
+  {
+    MultSymSingle<N1>(qd, 0, Q, i, u1, v1);
+    if (N2 > 0)
+    {
+      MultSymSingle<(N2 > 0) ? N2 : 1>(qd, N1 * (N1 + 1) / 2, Q, i, u2, v2);
+    }
+  }
+  return 0;
+}
+
+CEED_QFUNCTION(f_apply_single_1)(void *, CeedInt Q, const CeedScalar *const *in,
+                                 CeedScalar *const *out)
+{
+  return ApplySingle<1, 0>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_2)(void *, CeedInt Q, const CeedScalar *const *in,
+                                 CeedScalar *const *out)
+{
+  return ApplySingle<2, 0>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_3)(void *, CeedInt Q, const CeedScalar *const *in,
+                                 CeedScalar *const *out)
+{
+  return ApplySingle<3, 0>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_22)(void *, CeedInt Q, const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+  return ApplySingle<2, 2>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_33)(void *, CeedInt Q, const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+  return ApplySingle<3, 3>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_12)(void *, CeedInt Q, const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+  return ApplySingle<1, 2>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_13)(void *, CeedInt Q, const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+  return ApplySingle<1, 3>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_21)(void *, CeedInt Q, const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+  return ApplySingle<2, 1>(Q, in, out);
+}
+
+CEED_QFUNCTION(f_apply_single_31)(void *, CeedInt Q, const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+  return ApplySingle<3, 1>(Q, in, out);
+}
+
+#endif  // PALACE_LIBCEED_APPLY_SINGLE_QF_H
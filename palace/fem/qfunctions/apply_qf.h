@@ -13,6 +13,9 @@
 // data is arranged to be applied with the first vdim*(vdim+1)/2 components for the first
 // input/output and the remainder for the second.
 
+// Single precision apply functions are used with quadrature data which has been converted
+// to single precision after assembly, with two components packed into each CeedScalar.
+
 #include "apply/apply_12_qf.h"
 #include "apply/apply_13_qf.h"
 #include "apply/apply_1_qf.h"
@@ -22,5 +25,6 @@
 #include "apply/apply_31_qf.h"
 #include "apply/apply_33_qf.h"
 #include "apply/apply_3_qf.h"
+#include "apply/apply_single_qf.h"
 
 #endif  // PALACE_LIBCEED_APPLY_QF_H
@@ -0,0 +1,739 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "feast.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <mfem.hpp>
+#include "linalg/divfree.hpp"
+#include "linalg/orthog.hpp"
+#include "utils/communication.hpp"
+
+// Eigen does not provide a complex-valued genearlized eigenvalue solver, so we use LAPACK
+// for this.
+extern "C"
+{
+  void zggev_(char *, char *, int *, std::complex<double> *, int *, std::complex<double> *,
+              int *, std::complex<double> *, std::complex<double> *, std::complex<double> *,
+              int *, std::complex<double> *, int *, std::complex<double> *, int *, double *,
+              int *);
+}
+
+namespace palace::feast
+{
+
+using namespace std::complex_literals;
+
+namespace
+{
+
+constexpr auto ORTHOG_TOL = 1.0e-12;
+
+void ZGGEV(Eigen::MatrixXcd &A, Eigen::MatrixXcd &B, Eigen::VectorXcd &D,
+           Eigen::MatrixXcd &VR)
+{
+  // Wrapper for LAPACK's (z)ggev. A and B are overwritten by their Schur decompositions.
+  MFEM_VERIFY(A.rows() == A.cols() && B.rows() == B.cols() && A.rows() == B.rows(),
+              "Generalized eigenvalue problem expects A, B matrices to be square and have "
+              "same dimensions!");
+  char jobvl = 'N', jobvr = 'V';
+  int n = static_cast<int>(A.rows()), lwork = 2 * n;
+  std::vector<std::complex<double>> alpha(n), beta(n), work(lwork);
+  std::vector<double> rwork(8 * n);
+  Eigen::MatrixXcd VL(0, 0);
+  VR.resize(n, n);
+  int info = 0;
+
+  zggev_(&jobvl, &jobvr, &n, A.data(), &n, B.data(), &n, alpha.data(), beta.data(),
+         VL.data(), &n, VR.data(), &n, work.data(), &lwork, rwork.data(), &info);
+  MFEM_VERIFY(info == 0, "ZGGEV failed with info = " << info << "!");
+
+  // Postprocess the eigenvalues (infinite eigenvalues have β = 0).
+  D.resize(n);
+  for (int i = 0; i < n; i++)
+  {
+    D(i) = (beta[i] == 0.0)
+               ? ((alpha[i] == 0.0) ? std::numeric_limits<std::complex<double>>::quiet_NaN()
+                                    : mfem::infinity())
+               : alpha[i] / beta[i];
+  }
+}
+
+void ProjectOperator(MPI_Comm comm, const ComplexOperator &A,
+                     const std::vector<ComplexVector> &Q, ComplexVector &y,
+                     Eigen::MatrixXcd &Ar)
+{
+  // Compute Ar = Qᴴ A Q, with a single global reduction for the entire matrix.
+  const int r = static_cast<int>(Q.size());
+  Ar.resize(r, r);
+  for (int j = 0; j < r; j++)
+  {
+    A.Mult(Q[j], y);
+    linalg::LocalDots(y, Q, Ar.col(j).data(), r);
+  }
+  Mpi::GlobalSum(r * r, Ar.data(), comm);
+}
+
+}  // namespace
+
+// Base class methods
+
+FeastEigenvalueSolver::FeastEigenvalueSolver(MPI_Comm comm, int print)
+  : comm(comm), print(print)
+{
+  // Initialization.
+  nev = ncv = n = 0;
+  moments = 1;
+  rtol = 0.0;
+  max_it = 0;
+  gamma = delta = 1.0;
+  center = h = 0.0;
+  ar = 1.0;
+
+  opProj = nullptr;
+  opB = nullptr;
+}
+
+void FeastEigenvalueSolver::SetOperators(const ComplexOperator &K,
+                                         const ComplexOperator &M,
+                                         EigenvalueSolver::ScaleType type)
+{
+  MFEM_ABORT("SetOperators not defined for base class FeastEigenvalueSolver!");
+}
+
+void FeastEigenvalueSolver::SetOperators(const ComplexOperator &K,
+                                         const ComplexOperator &C,
+                                         const ComplexOperator &M,
+                                         EigenvalueSolver::ScaleType type)
+{
+  MFEM_ABORT("SetOperators not defined for base class FeastEigenvalueSolver!");
+}
+
+void FeastEigenvalueSolver::SetLinearSolver(const ComplexKspSolver &ksp)
+{
+  MFEM_ABORT("FEAST eigenvalue solver requires a linear solver for each contour "
+             "quadrature node!");
+}
+
+void FeastEigenvalueSolver::SetLinearSolver(int k, const ComplexKspSolver &ksp)
+{
+  MFEM_VERIFY(k >= 0 && static_cast<std::size_t>(k) < opInv.size(),
+              "Out of range contour quadrature node for FEAST linear solver (k = "
+                  << k << ", np = " << opInv.size() << ")!");
+  opInv[k] = &ksp;
+}
+
+void FeastEigenvalueSolver::SetDivFreeProjector(const DivFreeSolver<ComplexVector> &divfree)
+{
+  opProj = &divfree;
+}
+
+void FeastEigenvalueSolver::SetBMat(const Operator &B)
+{
+  MFEM_VERIFY(!opB || opB->Height() == B.Height(),
+              "Invalid modification of eigenvalue problem size!");
+  opB = &B;
+}
+
+void FeastEigenvalueSolver::SetNumModes(int num_eig, int num_vec)
+{
+  nev = num_eig;
+  ncv = (num_vec > 0) ? num_vec : std::max(20, 2 * nev + 1);  // Default from SLEPc
+}
+
+void FeastEigenvalueSolver::SetTol(double tol)
+{
+  rtol = tol;
+}
+
+void FeastEigenvalueSolver::SetMaxIter(int max_it)
+{
+  this->max_it = max_it;
+}
+
+void FeastEigenvalueSolver::SetContour(std::complex<double> s_lower,
+                                       std::complex<double> s_upper, double aspect_ratio,
+                                       int num_points, int num_moments)
+{
+  MFEM_VERIFY(s_lower != s_upper, "FEAST eigenvalue solver requires a contour with "
+                                  "distinct lower and upper targets!");
+  MFEM_VERIFY(aspect_ratio > 0.0, "FEAST eigenvalue solver requires a contour with "
+                                  "positive aspect ratio!");
+  MFEM_VERIFY(num_points > 0 && num_moments > 0,
+              "FEAST eigenvalue solver requires a positive number of contour quadrature "
+              "points and moments!");
+  center = 0.5 * (s_lower + s_upper);
+  h = 0.5 * (s_upper - s_lower);
+  ar = aspect_ratio;
+  moments = num_moments;
+
+  // Trapezoidal rule on the ellipse z(θ) = c + h (cos θ + i a sin θ), which converges
+  // exponentially for the resolvent. The weights include the 1 / (2πi) factor of the
+  // contour integral.
+  nodes.resize(num_points);
+  weights.resize(num_points);
+  for (int k = 0; k < num_points; k++)
+  {
+    const double theta = 2.0 * M_PI * (k + 0.5) / num_points;
+    nodes[k] = center + h * (std::cos(theta) + 1i * ar * std::sin(theta));
+    weights[k] = h * (-std::sin(theta) + 1i * ar * std::cos(theta)) / (1i * num_points);
+  }
+  opInv.assign(num_points, nullptr);
+}
+
+void FeastEigenvalueSolver::SetInitialSpace(const ComplexVector &v)
+{
+  MFEM_VERIFY(
+      n > 0,
+      "Must call SetOperators before using SetInitialSpace for FEAST eigenvalue solver!");
+  MFEM_VERIFY(v.Size() == n, "Invalid size mismatch for provided initial space vector!");
+  r.SetSize(n);
+  r.UseDevice(true);
+  r = v;
+}
+
+bool FeastEigenvalueSolver::InsideContour(std::complex<double> l) const
+{
+  if (!std::isfinite(l.real()) || !std::isfinite(l.imag()))
+  {
+    return false;
+  }
+  const std::complex<double> u = (l - center) / h;
+  return u.real() * u.real() + u.imag() * u.imag() / (ar * ar) < 1.0;
+}
+
+int FeastEigenvalueSolver::Solve()
+{
+  // Set some defaults. The subspace is constructed from a block of m vectors for each
+  // moment.
+  CheckParameters();
+  HYPRE_BigInt N = linalg::GlobalSize(comm, x1);
+  if (ncv > N)
+  {
+    ncv = mfem::internal::to_int(N);
+  }
+  if (max_it <= 0)
+  {
+    max_it = 20;
+  }
+  const int m = (ncv + moments - 1) / moments;
+
+  // Initialize the block of starting vectors, using the user provided initial space for the
+  // first column if available.
+  auto SetRandomColumn = [this](ComplexVector &y, int j)
+  {
+    std::vector<std::uint32_t> seeds(1);
+    std::seed_seq seed_gen{Mpi::Rank(comm), j};
+    seed_gen.generate(seeds.begin(), seeds.end());
+    linalg::SetRandom(comm, y, static_cast<int>(seeds[0] >> 1) + 1);
+  };
+  std::vector<ComplexVector> Y(m), BY(m), Z(m);
+  for (int j = 0; j < m; j++)
+  {
+    Y[j].SetSize(n);
+    BY[j].SetSize(n);
+    Z[j].SetSize(n);
+    Y[j].UseDevice(true);
+    BY[j].UseDevice(true);
+    Z[j].UseDevice(true);
+    if (j == 0 && r.Size() == n)
+    {
+      Y[j] = r;
+    }
+    else
+    {
+      SetRandomColumn(Y[j], j);
+    }
+  }
+
+  // Begin subspace iteration.
+  std::vector<std::complex<double>> H(m * moments);
+  Eigen::VectorXcd D;
+  Eigen::MatrixXcd Xr;
+  int it = 0, dim_Q = 0, num_inside = 0, num_conv = 0;
+  while (it < max_it)
+  {
+    it++;
+
+    // Apply the contour integral filter to the block of vectors. The shifted systems at
+    // each quadrature node are solved for the entire block of right-hand sides, and the
+    // moments are accumulated as Q_p = Σ_k w_k u_k^p T(z_k)⁻¹ B Y with u_k = (z_k - c) / h.
+    std::vector<ComplexVector> Q(m * moments);
+    for (auto &q : Q)
+    {
+      q.SetSize(n);
+      q.UseDevice(true);
+      q = 0.0;
+    }
+    for (int j = 0; j < m; j++)
+    {
+      ApplyOpB(Y[j], BY[j]);
+    }
+    for (std::size_t k = 0; k < nodes.size(); k++)
+    {
+      for (int j = 0; j < m; j++)
+      {
+        Z[j] = 0.0;
+      }
+      opInv[k]->Mult(BY, Z);
+      const std::complex<double> u = (nodes[k] - center) / h;
+      std::complex<double> wk = weights[k];
+      for (int p = 0; p < moments; p++)
+      {
+        for (int j = 0; j < m; j++)
+        {
+          Q[p * m + j].Add(wk, Z[j]);
+        }
+        wk *= u;
+      }
+    }
+
+    // Orthonormalize the filtered subspace with CGS2, dropping any linearly dependent
+    // columns.
+    dim_Q = 0;
+    for (std::size_t j = 0; j < Q.size(); j++)
+    {
+      if (opProj)
+      {
+        opProj->Mult(Q[j]);
+      }
+      const double norm0 = linalg::Norml2(comm, Q[j]);
+      if (static_cast<std::size_t>(dim_Q) < j)
+      {
+        Q[dim_Q] = Q[j];
+      }
+      linalg::OrthogonalizeColumnCGS(comm, Q, Q[dim_Q], H.data(), dim_Q, true);
+      const double norm = linalg::Norml2(comm, Q[dim_Q]);
+      if (norm0 > 0.0 && norm > ORTHOG_TOL * norm0)
+      {
+        Q[dim_Q] *= 1.0 / norm;
+        dim_Q++;
+      }
+    }
+    MFEM_VERIFY(dim_Q > 0, "FEAST eigenvalue solver encountered a zero filtered subspace!");
+    Q.resize(dim_Q);
+
+    // Rayleigh-Ritz projection and solve of the projected problem.
+    SolveProjected(Q, D, Xr);
+
+    // Sort the Ritz values: those inside of the contour first ordered along the axis from
+    // the lower to the upper target, then the rest ordered by distance from the contour.
+    auto Radius = [this](std::complex<double> l)
+    {
+      if (!std::isfinite(l.real()) || !std::isfinite(l.imag()))
+      {
+        return mfem::infinity();
+      }
+      const std::complex<double> u = (l - center) / h;
+      return std::sqrt(u.real() * u.real() + u.imag() * u.imag() / (ar * ar));
+    };
+    std::vector<int> idx(D.size());
+    for (std::size_t i = 0; i < idx.size(); i++)
+    {
+      idx[i] = static_cast<int>(i);
+    }
+    std::sort(idx.begin(), idx.end(),
+              [this, &D, &Radius](int a, int b)
+              {
+                const bool inside_a = InsideContour(D(a)), inside_b = InsideContour(D(b));
+                if (inside_a != inside_b)
+                {
+                  return inside_a;
+                }
+                return inside_a ? (D(a) / h).real() < (D(b) / h).real()
+                                : Radius(D(a)) < Radius(D(b));
+              });
+
+    // Compute the Ritz vectors and residuals.
+    const int num_keep = std::min(static_cast<int>(D.size()), ncv);
+    eig.resize(num_keep);
+    X.resize(num_keep);
+    res.resize(num_keep);
+    xscale.assign(num_keep, 0.0);
+    num_inside = num_conv = 0;
+    for (int i = 0; i < num_keep; i++)
+    {
+      eig[i] = D(idx[i]);
+      X[i].SetSize(n);
+      X[i].UseDevice(true);
+      X[i] = 0.0;
+      for (int l = 0; l < dim_Q; l++)
+      {
+        X[i].Add(Xr(l, idx[i]), Q[l]);
+      }
+      const double norm = linalg::Norml2(comm, X[i]);
+      if (norm > 0.0)
+      {
+        X[i] *= 1.0 / norm;
+      }
+      res[i] = GetResidualNorm(eig[i], X[i], y1);
+      if (InsideContour(eig[i]))
+      {
+        num_inside++;
+        num_conv += (res[i] / GetBackwardScaling(eig[i]) < rtol);
+      }
+    }
+    if (print > 0)
+    {
+      Mpi::Print(comm,
+                 " FEAST iteration {:d}: {:d} eigenvalue{} inside contour, {:d} converged "
+                 "(subspace dimension = {:d})\n",
+                 it, num_inside, (num_inside == 1) ? "" : "s", num_conv, dim_Q);
+    }
+    if (num_inside > 0 && num_conv == num_inside)
+    {
+      break;
+    }
+
+    // Update the block of vectors with the leading Ritz vectors for the next iteration.
+    for (int j = 0; j < m; j++)
+    {
+      if (j < num_keep)
+      {
+        Y[j] = X[j];
+      }
+      else
+      {
+        SetRandomColumn(Y[j], it * m + j);
+      }
+    }
+  }
+
+  // Order the converged eigenpairs inside of the contour first, preserving the sorted
+  // order.
+  perm.resize(eig.size());
+  for (std::size_t i = 0; i < perm.size(); i++)
+  {
+    perm[i] = static_cast<int>(i);
+  }
+  std::stable_partition(perm.begin(), perm.begin() + num_inside,
+                        [this](int i)
+                        { return res[i] / GetBackwardScaling(eig[i]) < rtol; });
+
+  // Print some log information.
+  if (print > 0)
+  {
+    Mpi::Print(comm,
+               "\n FEAST {} eigensolve {} ({:d} eigenpairs); iterations {:d}\n"
+               " Total number of linear systems solved: {:d}\n"
+               " Total number of linear solver iterations: {:d}\n",
+               GetName(), (num_conv == num_inside) ? "converged" : "finished", num_conv, it,
+               NumTotalMult(), NumTotalMultIterations());
+  }
+  if (num_inside >= dim_Q)
+  {
+    Mpi::Warning(comm,
+                 "FEAST eigenvalue solver subspace dimension may be too small for the "
+                 "number of eigenvalues inside of the contour, consider increasing "
+                 "\"MaxSize\"!\n");
+  }
+  if (num_conv < num_inside)
+  {
+    Mpi::Warning(comm,
+                 "FEAST eigenvalue solver converged only {:d} of {:d} eigenvalues inside "
+                 "of the contour!\n",
+                 num_conv, num_inside);
+  }
+
+  // Compute the eigenvector normalizations and eigenpair residuals.
+  RescaleEigenvectors(static_cast<int>(eig.size()));
+
+  // Reset for next solve.
+  r.SetSize(0);
+  return num_conv;
+}
+
+void FeastEigenvalueSolver::CheckParameters() const
+{
+  MFEM_VERIFY(n > 0, "Operators are not set for FEAST eigenvalue solver!");
+  MFEM_VERIFY(nev > 0, "Number of requested modes is not positive!");
+  MFEM_VERIFY(rtol > 0.0, "Eigensolver tolerance is not positive!");
+  MFEM_VERIFY(!nodes.empty(), "Contour is not set for FEAST eigenvalue solver!");
+  for (const auto *ksp : opInv)
+  {
+    MFEM_VERIFY(ksp, "No linear solver provided for each contour quadrature node!");
+  }
+}
+
+std::complex<double> FeastEigenvalueSolver::GetEigenvalue(int i) const
+{
+  MFEM_VERIFY(i >= 0 && static_cast<std::size_t>(i) < eig.size(),
+              "Out of range eigenpair requested (i = " << i << ", n = " << eig.size()
+                                                       << ")!");
+  const int &j = perm[i];
+  return eig[j];
+}
+
+void FeastEigenvalueSolver::GetEigenvector(int i, ComplexVector &x) const
+{
+  MFEM_VERIFY(i >= 0 && static_cast<std::size_t>(i) < eig.size(),
+              "Out of range eigenpair requested (i = " << i << ", n = " << eig.size()
+                                                       << ")!");
+  MFEM_VERIFY(x.Size() == n, "Invalid size mismatch for provided eigenvector!");
+  const int &j = perm[i];
+  x = X[j];
+  if (xscale[j] > 0.0)
+  {
+    x *= xscale[j];
+  }
+}
+
+double FeastEigenvalueSolver::GetEigenvectorNorm(const ComplexVector &x,
+                                                 ComplexVector &Bx) const
+{
+  if (opB)
+  {
+    return linalg::Norml2(comm, x, *opB, Bx);
+  }
+  else
+  {
+    return linalg::Norml2(comm, x);
+  }
+}
+
+double FeastEigenvalueSolver::GetError(int i, EigenvalueSolver::ErrorType type) const
+{
+  MFEM_VERIFY(i >= 0 && static_cast<std::size_t>(i) < eig.size(),
+              "Out of range eigenpair requested (i = " << i << ", n = " << eig.size()
+                                                       << ")!");
+  const int &j = perm[i];
+  switch (type)
+  {
+    case ErrorType::ABSOLUTE:
+      return res[j];
+    case ErrorType::RELATIVE:
+      return res[j] / std::abs(eig[j]);
+    case ErrorType::BACKWARD:
+      return res[j] / GetBackwardScaling(eig[j]);
+  }
+  return 0.0;
+}
+
+void FeastEigenvalueSolver::RescaleEigenvectors(int num_eig)
+{
+  for (int i = 0; i < std::min(num_eig, static_cast<int>(eig.size())); i++)
+  {
+    const int &j = perm[i];
+    xscale[j] = 1.0 / GetEigenvectorNorm(X[j], y1);
+    res[j] = GetResidualNorm(eig[j], X[j], y1) / linalg::Norml2(comm, X[j]);
+  }
+}
+
+int FeastEigenvalueSolver::NumTotalMult() const
+{
+  int num = 0;
+  for (const auto *ksp : opInv)
+  {
+    num += ksp ? ksp->NumTotalMult() : 0;
+  }
+  return num;
+}
+
+int FeastEigenvalueSolver::NumTotalMultIterations() const
+{
+  int num = 0;
+  for (const auto *ksp : opInv)
+  {
+    num += ksp ? ksp->NumTotalMultIterations() : 0;
+  }
+  return num;
+}
+
+int FeastEigenvalueSolver::NumTotalPreconditionerSetup() const
+{
+  int num = 0;
+  for (const auto *ksp : opInv)
+  {
+    num += ksp ? ksp->NumTotalPreconditionerSetup() : 0;
+  }
+  return num;
+}
+
+// EPS specific methods
+
+FeastEPSSolver::FeastEPSSolver(MPI_Comm comm, int print)
+  : FeastEigenvalueSolver(comm, print)
+{
+  opK = opM = nullptr;
+  normK = normM = 0.0;
+}
+
+void FeastEPSSolver::SetOperators(const ComplexOperator &K, const ComplexOperator &M,
+                                  EigenvalueSolver::ScaleType type)
+{
+  MFEM_VERIFY(!opK || K.Height() == n, "Invalid modification of eigenvalue problem size!");
+  bool first = (opK == nullptr);
+  opK = &K;
+  opM = &M;
+  if (first && type != ScaleType::NONE)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+    MFEM_VERIFY(normK >= 0.0 && normM >= 0.0, "Invalid matrix norms for EPS scaling!");
+    if (normK > 0 && normM > 0.0)
+    {
+      gamma = normK / normM;  // Store γ² for linear problem
+      delta = 2.0 / normK;
+    }
+  }
+
+  // Set up workspace.
+  x1.SetSize(opK->Height());
+  y1.SetSize(opK->Height());
+  x1.UseDevice(true);
+  y1.UseDevice(true);
+  n = opK->Height();
+}
+
+void FeastEPSSolver::ApplyOpB(const ComplexVector &y, ComplexVector &By) const
+{
+  // The contour integral of the resolvent (K - z M)⁻¹ M is the spectral projector onto the
+  // eigenvectors with eigenvalues inside of the contour (up to sign).
+  opM->Mult(y, By);
+}
+
+void FeastEPSSolver::SolveProjected(const std::vector<ComplexVector> &Q,
+                                    Eigen::VectorXcd &D, Eigen::MatrixXcd &Xr) const
+{
+  // Solve the projected generalized eigenvalue problem Qᴴ K Q y = λ Qᴴ M Q y, scaled for
+  // λ = γ λ̃.
+  Eigen::MatrixXcd Kr, Mr;
+  ProjectOperator(comm, *opK, Q, y1, Kr);
+  ProjectOperator(comm, *opM, Q, y1, Mr);
+  Kr *= delta;
+  Mr *= delta * gamma;
+  ZGGEV(Kr, Mr, D, Xr);
+  D *= gamma;
+}
+
+double FeastEPSSolver::GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                                       ComplexVector &r) const
+{
+  // Compute the i-th eigenpair residual: || (K - λ M) x ||₂ for eigenvalue λ.
+  opK->Mult(x, r);
+  opM->AddMult(x, r, -l);
+  return linalg::Norml2(comm, r);
+}
+
+double FeastEPSSolver::GetBackwardScaling(std::complex<double> l) const
+{
+  // Make sure not to use norms from scaling as this can be confusing if they are different.
+  // Note that SLEPc uses ||.||∞, not the 2-norm.
+  if (normK <= 0.0)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+  }
+  if (normM <= 0.0)
+  {
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+  }
+  return normK + std::abs(l) * normM;
+}
+
+// PEP specific methods
+
+FeastPEPSolver::FeastPEPSolver(MPI_Comm comm, int print)
+  : FeastEigenvalueSolver(comm, print)
+{
+  opK = opC = opM = nullptr;
+  normK = normC = normM = 0.0;
+}
+
+void FeastPEPSolver::SetOperators(const ComplexOperator &K, const ComplexOperator &C,
+                                  const ComplexOperator &M,
+                                  EigenvalueSolver::ScaleType type)
+{
+  MFEM_VERIFY(!opK || K.Height() == n, "Invalid modification of eigenvalue problem size!");
+  bool first = (opK == nullptr);
+  opK = &K;
+  opC = &C;
+  opM = &M;
+  if (first && type != ScaleType::NONE)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+    normC = linalg::SpectralNorm(comm, *opC, opC->IsReal());
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+    MFEM_VERIFY(normK >= 0.0 && normC >= 0.0 && normM >= 0.0,
+                "Invalid matrix norms for PEP scaling!");
+    if (normK > 0 && normC > 0.0 && normM > 0.0)
+    {
+      gamma = std::sqrt(normK / normM);
+      delta = 2.0 / (normK + gamma * normC);
+    }
+  }
+
+  // Set up workspace.
+  x1.SetSize(opK->Height());
+  y1.SetSize(opK->Height());
+  x1.UseDevice(true);
+  y1.UseDevice(true);
+  n = opK->Height();
+}
+
+void FeastPEPSolver::ApplyOpB(const ComplexVector &y, ComplexVector &By) const
+{
+  // For the quadratic problem, the contour integral of P(z)⁻¹ applied to a block of probing
+  // vectors spans the eigenvectors with eigenvalues inside of the contour (Beyn, 2012).
+  opM->Mult(y, By);
+}
+
+void FeastPEPSolver::SolveProjected(const std::vector<ComplexVector> &Q,
+                                    Eigen::VectorXcd &D, Eigen::MatrixXcd &Xr) const
+{
+  // Solve the projected quadratic eigenvalue problem Qᴴ P(λ) Q y = 0 using the
+  // linearization L₀ w = λ̃ L₁ w with w = [y; λ̃ y], λ = γ λ̃, and:
+  //               L₀ = [  0    I  ]    L₁ = [ I  0  ]
+  //                    [ -K̃  -C̃ ] ,       [ 0  M̃ ] .
+  const int r = static_cast<int>(Q.size());
+  Eigen::MatrixXcd Kr, Cr, Mr;
+  ProjectOperator(comm, *opK, Q, y1, Kr);
+  ProjectOperator(comm, *opC, Q, y1, Cr);
+  ProjectOperator(comm, *opM, Q, y1, Mr);
+  Eigen::MatrixXcd L0 = Eigen::MatrixXcd::Zero(2 * r, 2 * r),
+                   L1 = Eigen::MatrixXcd::Zero(2 * r, 2 * r), W;
+  L0.topRightCorner(r, r).setIdentity();
+  L0.bottomLeftCorner(r, r) = -delta * Kr;
+  L0.bottomRightCorner(r, r) = -delta * gamma * Cr;
+  L1.topLeftCorner(r, r).setIdentity();
+  L1.bottomRightCorner(r, r) = delta * gamma * gamma * Mr;
+  ZGGEV(L0, L1, D, W);
+  D *= gamma;
+  Xr = W.topRows(r);
+}
+
+double FeastPEPSolver::GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                                       ComplexVector &r) const
+{
+  // Compute the i-th eigenpair residual: || P(λ) x ||₂ = || (K + λ C + λ² M) x ||₂ for
+  // eigenvalue λ.
+  opK->Mult(x, r);
+  opC->AddMult(x, r, l);
+  opM->AddMult(x, r, l * l);
+  return linalg::Norml2(comm, r);
+}
+
+double FeastPEPSolver::GetBackwardScaling(std::complex<double> l) const
+{
+  // Make sure not to use norms from scaling as this can be confusing if they are different.
+  // Note that SLEPc uses ||.||∞, not the 2-norm.
+  if (normK <= 0.0)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+  }
+  if (normC <= 0.0)
+  {
+    normC = linalg::SpectralNorm(comm, *opC, opC->IsReal());
+  }
+  if (normM <= 0.0)
+  {
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+  }
+  double t = std::abs(l);
+  return normK + t * normC + t * t * normM;
+}
+
+}  // namespace palace::feast
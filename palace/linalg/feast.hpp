@@ -0,0 +1,272 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_FEAST_HPP
+#define PALACE_LINALG_FEAST_HPP
+
+#include <complex>
+#include <vector>
+#include <Eigen/Dense>
+#include <mpi.h>
+#include "linalg/eps.hpp"
+#include "linalg/ksp.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+namespace feast
+{
+
+//
+// A native contour integral (FEAST-style) eigenvalue solver for generalized linear
+// eigenvalue problems or quadratic polynomial eigenvalue problems. All eigenvalues inside
+// of an elliptical contour in the complex plane are computed using a subspace iteration
+// with the filter constructed from a quadrature rule for the resolvent along the contour,
+// followed by a Rayleigh-Ritz projection. The shifted linear systems at each quadrature
+// node are solved as a block of right-hand sides, with a separate linear solver for each
+// node which is reused across subspace iterations.
+//
+class FeastEigenvalueSolver : public EigenvalueSolver
+{
+protected:
+  // MPI communicator.
+  MPI_Comm comm;
+
+  // Control print level for debugging.
+  int print;
+
+  // Number eigenvalues to be computed, subspace dimension, and problem size.
+  int nev, ncv, n;
+
+  // Number of moments used for subspace construction.
+  int moments;
+
+  // Relative eigenvalue error convergence tolerance for the solver.
+  double rtol;
+
+  // Maximum number of subspace iterations.
+  int max_it;
+
+  // Variables for scaling, from Higham et al., IJNME 2008.
+  double gamma, delta;
+
+  // Parameters defining the elliptical contour: center, half of the vector between the
+  // lower and upper targets, and aspect ratio.
+  std::complex<double> center, h;
+  double ar;
+
+  // Quadrature nodes and weights for the contour integral.
+  std::vector<std::complex<double>> nodes, weights;
+
+  // Storage for computed eigenvalues, eigenvectors, and sorting permutation.
+  std::vector<std::complex<double>> eig;
+  std::vector<ComplexVector> X;
+  std::vector<int> perm;
+
+  // Storage for computed residual norms and eigenvector scalings.
+  std::vector<double> res, xscale;
+
+  // Optional initial vector for the solution subspace.
+  ComplexVector r;
+
+  // References to linear solvers for the shifted operator at each contour quadrature node
+  // (not owned).
+  std::vector<const ComplexKspSolver *> opInv;
+
+  // Reference to solver for projecting an intermediate vector onto a divergence-free space
+  // (not owned).
+  const DivFreeSolver<ComplexVector> *opProj;
+
+  // Reference to matrix used for weighted inner products (not owned). May be nullptr, in
+  // which case identity is used.
+  const Operator *opB;
+
+  // Workspace vector for operator applications.
+  mutable ComplexVector x1, y1;
+
+  // Helper routine for parameter checking.
+  void CheckParameters() const;
+
+  // Helper routine for checking whether a given eigenvalue lies inside of the contour.
+  bool InsideContour(std::complex<double> l) const;
+
+  // Helper routine for computing the right-hand side B y for the contour integral.
+  virtual void ApplyOpB(const ComplexVector &y, ComplexVector &By) const = 0;
+
+  // Solve the projected eigenvalue problem for the given orthonormal basis Q, returning
+  // the Ritz values and coefficients of the Ritz vectors in the basis.
+  virtual void SolveProjected(const std::vector<ComplexVector> &Q,
+                              Eigen::VectorXcd &D, Eigen::MatrixXcd &Xr) const = 0;
+
+  // Helper routine for computing the eigenvector normalization.
+  double GetEigenvectorNorm(const ComplexVector &x, ComplexVector &Bx) const;
+
+  // Helper routine for computing the eigenpair residual.
+  virtual double GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                                 ComplexVector &r) const = 0;
+
+  // Helper routine for computing the backward error.
+  virtual double GetBackwardScaling(std::complex<double> l) const = 0;
+
+  // Return problem type name.
+  virtual const char *GetName() const = 0;
+
+public:
+  FeastEigenvalueSolver(MPI_Comm comm, int print);
+
+  // Set operators for the generalized eigenvalue problem or for the quadratic polynomial
+  // eigenvalue problem.
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &M,
+                    ScaleType type) override;
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &C,
+                    const ComplexOperator &M, ScaleType type) override;
+
+  // The FEAST solver requires a linear solver for each contour quadrature node, configured
+  // using SetLinearSolver(k, ksp).
+  void SetLinearSolver(const ComplexKspSolver &ksp) override;
+
+  // For the linear generalized case, the linear solver for quadrature node k should be
+  // configured to compute the action of (K - z_k M)⁻¹. For the quadratic case, it should
+  // compute the action of P(z_k)⁻¹ = (K + z_k C + z_k² M)⁻¹.
+  void SetLinearSolver(int k, const ComplexKspSolver &ksp);
+
+  // Set the projection operator for enforcing the divergence-free constraint.
+  void SetDivFreeProjector(const DivFreeSolver<ComplexVector> &divfree) override;
+
+  // Set optional B matrix used for weighted inner products. This must be set explicitly
+  // even for generalized problems, otherwise the identity will be used.
+  void SetBMat(const Operator &B) override;
+
+  // Get scaling factors used by the solver.
+  double GetScalingGamma() const override { return gamma; }
+  double GetScalingDelta() const override { return delta; }
+
+  // Set the number of required eigenmodes. For the FEAST solver, this is an estimate of the
+  // number of eigenvalues inside of the contour used to size the search subspace.
+  void SetNumModes(int num_eig, int num_vec = 0) override;
+
+  // Set solver tolerance.
+  void SetTol(double tol) override;
+
+  // Set maximum number of subspace iterations.
+  void SetMaxIter(int max_it) override;
+
+  // The FEAST solver computes all eigenvalues inside of the contour, so this has no effect.
+  void SetWhichEigenpairs(WhichType type) override {}
+
+  // The FEAST solver does not use a spectral transformation, the contour is configured
+  // using SetContour.
+  void SetShiftInvert(std::complex<double> s, bool precond = false) override {}
+
+  // Set the elliptical contour enclosing the desired eigenvalues. The contour has its major
+  // axis along the segment between the lower and upper targets, and the aspect ratio is the
+  // ratio of the length of the minor axis to that of the major axis. The number of
+  // quadrature points and moments used for subspace construction are also specified.
+  void SetContour(std::complex<double> s_lower, std::complex<double> s_upper,
+                  double aspect_ratio, int num_points, int num_moments = 1);
+
+  // Get the quadrature nodes along the contour, at which the linear solvers are required.
+  const std::vector<std::complex<double>> &GetContourNodes() const { return nodes; }
+
+  // Set an initial vector for the solution subspace.
+  void SetInitialSpace(const ComplexVector &v) override;
+
+  // Solve the eigenvalue problem. Returns the number of converged eigenvalues inside of the
+  // contour.
+  int Solve() override;
+
+  // Get the corresponding eigenvalue.
+  std::complex<double> GetEigenvalue(int i) const override;
+
+  // Get the corresponding eigenvector. Eigenvectors are normalized such that ||x||₂ = 1,
+  // unless the B-matrix is set for weighted inner products.
+  void GetEigenvector(int i, ComplexVector &x) const override;
+
+  // Get the corresponding eigenpair error.
+  double GetError(int i, ErrorType type) const override;
+
+  // Re-normalize the given number of eigenvectors, for example if the matrix B for weighted
+  // inner products has changed. This does not perform re-orthogonalization with respect to
+  // the new matrix, only normalization.
+  void RescaleEigenvectors(int num_eig) override;
+
+  // Get the number of computed eigenpairs, including those which are not converged or lie
+  // outside of the contour.
+  int GetNumEigenpairs() const { return static_cast<int>(eig.size()); }
+
+  // Get the linear solver statistics summed over all quadrature nodes.
+  int NumTotalMult() const;
+  int NumTotalMultIterations() const;
+  int NumTotalPreconditionerSetup() const;
+};
+
+// Generalized eigenvalue problem solver: K x = λ M x .
+class FeastEPSSolver : public FeastEigenvalueSolver
+{
+private:
+  // References to matrices defining the generalized eigenvalue problem (not owned).
+  const ComplexOperator *opK, *opM;
+
+  // Operator norms for scaling.
+  mutable double normK, normM;
+
+protected:
+  void ApplyOpB(const ComplexVector &y, ComplexVector &By) const override;
+
+  void SolveProjected(const std::vector<ComplexVector> &Q,
+                      Eigen::VectorXcd &D, Eigen::MatrixXcd &Xr) const override;
+
+  double GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                         ComplexVector &r) const override;
+
+  double GetBackwardScaling(std::complex<double> l) const override;
+
+  const char *GetName() const override { return "EPS"; }
+
+public:
+  FeastEPSSolver(MPI_Comm comm, int print);
+
+  using FeastEigenvalueSolver::SetOperators;
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &M,
+                    ScaleType type) override;
+};
+
+// Quadratic eigenvalue problem solver: P(λ) x = (K + λ C + λ² M) x = 0 .
+class FeastPEPSolver : public FeastEigenvalueSolver
+{
+private:
+  // References to matrices defining the quadratic polynomial eigenvalue problem
+  // (not owned).
+  const ComplexOperator *opK, *opC, *opM;
+
+  // Operator norms for scaling.
+  mutable double normK, normC, normM;
+
+protected:
+  void ApplyOpB(const ComplexVector &y, ComplexVector &By) const override;
+
+  void SolveProjected(const std::vector<ComplexVector> &Q,
+                      Eigen::VectorXcd &D, Eigen::MatrixXcd &Xr) const override;
+
+  double GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                         ComplexVector &r) const override;
+
+  double GetBackwardScaling(std::complex<double> l) const override;
+
+  const char *GetName() const override { return "PEP"; }
+
+public:
+  FeastPEPSolver(MPI_Comm comm, int print);
+
+  using FeastEigenvalueSolver::SetOperators;
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &C,
+                    const ComplexOperator &M, ScaleType type) override;
+};
+
+}  // namespace feast
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_FEAST_HPP
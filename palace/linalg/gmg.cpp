@@ -7,6 +7,7 @@
 #include "linalg/chebyshev.hpp"
 #include "linalg/distrelaxation.hpp"
 #include "linalg/rap.hpp"
+#include "utils/profiler.hpp"
 #include "utils/timer.hpp"
 
 namespace palace
@@ -173,7 +174,9 @@ void GeometricMultigridSolver<OperType>::VCycle(int l, bool initial_guess) const
 {
   // Pre-smooth, with zero initial guess (Y = 0 set inside). This is the coarse solve at
   // level 0. Important to note that the smoothers must respect the initial guess flag
-  // correctly (given X, Y, compute Y <- Y + B (X - A Y)) .
+  // correctly (given X, Y, compute Y <- Y + B (X - A Y)) . Each level is profiled as a
+  // region nested within the next finer level.
+  ProfileRegion region("Level " + std::to_string(l), use_timer);
   B[l]->SetInitialGuess(initial_guess);
   if (l == 0)
   {
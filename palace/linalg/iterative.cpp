@@ -6,7 +6,10 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 #include <string>
+#include <utility>
+#include <Eigen/Dense>
 #include "linalg/orthog.hpp"
 #include "utils/communication.hpp"
 #include "utils/timer.hpp"
@@ -305,11 +308,12 @@ inline void ApplyBA(GmresSolverBase::PrecSide side, const OperType *A,
 }
 
 template <typename VecType, typename ScalarType>
-inline void OrthogonalizeIteration(GmresSolverBase::OrthogType type, MPI_Comm comm,
-                                   const std::vector<VecType> &V, VecType &w,
-                                   ScalarType *Hj, int j)
+inline double OrthogonalizeIteration(GmresSolverBase::OrthogType type, MPI_Comm comm,
+                                     const std::vector<VecType> &V, VecType &w,
+                                     ScalarType *Hj, int j)
 {
-  // Orthogonalize w against the leading j + 1 columns of V.
+  // Orthogonalize w against the leading j + 1 columns of V, returning the norm of the
+  // orthogonalized vector.
   switch (type)
   {
     case GmresSolverBase::OrthogType::MGS:
@@ -321,7 +325,40 @@ inline void OrthogonalizeIteration(GmresSolverBase::OrthogType type, MPI_Comm co
     case GmresSolverBase::OrthogType::CGS2:
       linalg::OrthogonalizeColumnCGS(comm, V, w, Hj, j + 1, true);
       break;
+    case GmresSolverBase::OrthogType::CGS_FUSED:
+      return linalg::OrthogonalizeColumnCGSFused(comm, V, w, Hj, j + 1);
+    case GmresSolverBase::OrthogType::CGS2_FUSED:
+      return linalg::OrthogonalizeColumnCGSFused(comm, V, w, Hj, j + 1, true);
   }
+  return linalg::Norml2(comm, w);
+}
+
+inline double LocalTransposeDot(const Vector &x, const Vector &y)
+{
+  return linalg::LocalDot(x, y);
+}
+
+inline std::complex<double> LocalTransposeDot(const ComplexVector &x,
+                                              const ComplexVector &y)
+{
+  return x.TransposeDot(y);
+}
+
+template <typename VecType>
+inline auto TransposeDot(MPI_Comm comm, const VecType &x, const VecType &y)
+{
+  // Parallel indefinite inner product yᵀ x (equal to the usual inner product for real
+  // vectors).
+  auto dot = LocalTransposeDot(x, y);
+  Mpi::GlobalSum(1, &dot, comm);
+  return dot;
+}
+
+template <typename T>
+inline bool IsBreakdown(T dot)
+{
+  // Also catches NaN or Inf from a previous division.
+  return !(std::abs(dot) > 0.0 && std::isfinite(std::abs(dot)));
 }
 
 }  // namespace
@@ -486,254 +523,931 @@ void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
 }
 
 template <typename OperType>
-void GmresSolver<OperType>::Initialize() const
+void CgSolver<OperType>::Mult(const std::vector<VecType> &b, std::vector<VecType> &x) const
 {
-  if (!V.empty())
+  // Set up workspace. See O'Leary, The block conjugate gradient algorithm and related
+  // methods, Linear Algebra Appl. (1980). Here the search directions are orthonormalized
+  // with respect to A at each iteration, which is a stable way to handle rank deficiency.
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  MFEM_VERIFY(A, "Operator must be set for CgSolver::Mult!");
+  MFEM_VERIFY(b.size() == x.size(),
+              "Mismatch in number of right-hand sides and solution vectors for CgSolver!");
+  const int n = static_cast<int>(b.size());
+  R.resize(n);
+  Z.resize(n);
+  P.resize(n);
+  Q.resize(n);
+  for (int i = 0; i < n; i++)
   {
-    MFEM_ASSERT(V.size() == static_cast<std::size_t>(max_dim + 1) &&
-                    V[0].Size() == A->Height(),
-                "Repeated solves with GmresSolver should not modify the operator size or "
-                "restart dimension!");
-    return;
+    MFEM_ASSERT(A->Width() == x[i].Size() && A->Height() == b[i].Size(),
+                "Size mismatch for CgSolver::Mult!");
+    R[i].SetSize(A->Height());
+    Z[i].SetSize(A->Height());
+    P[i].SetSize(A->Height());
+    Q[i].SetSize(A->Height());
+    R[i].UseDevice(true);
+    Z[i].UseDevice(true);
+    P[i].UseDevice(true);
+    Q[i].UseDevice(true);
   }
-  if (max_dim < 0)
+
+  // Initialize. The norms for all right-hand sides and residuals share a single global
+  // reduction.
+  std::vector<ScalarType> dots(2 * n);
+  for (int i = 0; i < n; i++)
   {
-    max_dim = max_it;
+    if (this->initial_guess)
+    {
+      A->Mult(x[i], R[i]);
+      linalg::AXPBY(1.0, b[i], -1.0, R[i]);
+    }
+    else
+    {
+      R[i] = b[i];
+      x[i] = 0.0;
+    }
+    dots[i] = linalg::LocalDot(b[i], b[i]);
+    dots[n + i] = linalg::LocalDot(R[i], R[i]);
   }
-  constexpr int init_size = 5;
-  V.resize(max_dim + 1);
-  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+  Mpi::GlobalSum(2 * n, dots.data(), comm);
+  std::vector<RealType> res(n), eps(n);
+  std::vector<int> active;
+  RealType res_rhs = 0.0;
+  for (int i = 0; i < n; i++)
   {
-    V[j].SetSize(A->Height());
-    V[j].UseDevice(true);
+    res[i] = std::sqrt(std::abs(dots[n + i]));
+    eps[i] = std::max(rel_tol * std::sqrt(std::abs(dots[i])), abs_tol);
+    res_rhs += std::abs(dots[i]);
+    if (res[i] >= eps[i])
+    {
+      active.push_back(i);
+    }
   }
-  H.resize((max_dim + 1) * max_dim);
-  s.resize(max_dim + 1);
-  cs.resize(max_dim + 1);
-  sn.resize(max_dim + 1);
-}
+  auto ResidualNorm = [&res]()
+  {
+    RealType res2 = 0.0;
+    for (auto r_i : res)
+    {
+      res2 += r_i * r_i;
+    }
+    return std::sqrt(res2);
+  };
+  initial_res = std::sqrt(res_rhs);
 
-template <typename OperType>
-void GmresSolver<OperType>::Update(int j) const
-{
-  // Add storage for basis vectors in increments.
-  constexpr int add_size = 10;
-  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  // The initial search directions are the preconditioned residuals of the unconverged
+  // systems.
+  int m = static_cast<int>(active.size());
+  for (int j = 0; j < m; j++)
   {
-    V[k].SetSize(A->Height());
-    V[k].UseDevice(true);
+    if (B)
+    {
+      ApplyB(B, R[active[j]], P[j], this->use_timer);
+    }
+    else
+    {
+      P[j] = R[active[j]];
+    }
   }
-}
-
-template <typename OperType>
-void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
-{
-  // Set up workspace.
-  RealType beta = 0.0, true_beta, eps = 0.0;
-  MFEM_VERIFY(A, "Operator must be set for GmresSolver::Mult!");
-  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
-              "Size mismatch for GmresSolver::Mult!");
-  r.SetSize(A->Height());
-  r.UseDevice(true);
-  Initialize();
 
   // Begin iterations.
-  converged = false;
-  int it = 0, restart = 0;
+  int it = 0;
+  bool breakdown = false;
   if (print_opts.iterations)
   {
-    Mpi::Print(comm, "{}Residual norms for GMRES solve\n",
-               std::string(tab_width + int_width - 1, ' '));
+    Mpi::Print(comm, "{}Residual norms for block PCG solve ({:d} right-hand sides)\n",
+               std::string(tab_width + int_width - 1, ' '), n);
   }
-  for (; it < max_it; restart++)
+  for (; it < max_it && !active.empty(); it++)
   {
-    // Initialize.
-    InitialResidual(pc_side, A, B, b, x, r, V[0], (this->initial_guess || restart > 0),
-                    this->use_timer);
-    true_beta = linalg::Norml2(comm, r);
-    CheckDot(true_beta, "GMRES residual norm is not valid: beta = ");
-    if (it == 0)
+    if (print_opts.iterations)
     {
-      if (this->initial_guess)
-      {
-        RealType beta_rhs;
-        if (B && pc_side == PrecSide::LEFT)
-        {
-          ApplyB(B, b, V[0], this->use_timer);
-          beta_rhs = linalg::Norml2(comm, V[0]);
-        }
-        else  // !B || pc_side == PrecSide::RIGHT
-        {
-          beta_rhs = linalg::Norml2(comm, b);
-        }
-        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
-        initial_res = beta_rhs;
-      }
-      else
-      {
-        initial_res = true_beta;
-      }
-      eps = std::max(rel_tol * initial_res, abs_tol);
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||R||_F = {:.6e} ({:d} active)\n",
+                 std::string(tab_width, ' '), it, int_width, ResidualNorm(),
+                 active.size());
     }
-    else if (beta > 0.0 && std::abs(beta - true_beta) > 0.1 * true_beta &&
-             print_opts.warnings)
+
+    // A-orthonormalize the search directions using the eigendecomposition of the Gram
+    // matrix, Pᴴ A P = W Λ Wᴴ and P ← P W Λ^{-1/2}, dropping any (nearly) dependent ones.
+    for (int j = 0; j < m; j++)
     {
-      Mpi::Print(
-          comm,
-          "{}GMRES residual at restart ({:.6e}) is far from the residual norm estimate "
-          "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
-          std::string(tab_width, ' '), true_beta, beta, initial_res);
+      A->Mult(P[j], Q[j]);
     }
-    beta = true_beta;
-    if (beta < eps)
+    MatType G(m, m);
+    for (int j = 0; j < m; j++)
     {
-      converged = true;
+      linalg::LocalDots(Q[j], P, G.col(j).data(), m);
+    }
+    Mpi::GlobalSum(m * m, G.data(), comm);
+    Eigen::SelfAdjointEigenSolver<MatType> eig(G);
+    const auto &lambda = eig.eigenvalues();
+    if (eig.info() != Eigen::Success || !(lambda(m - 1) > 0.0))
+    {
+      breakdown = true;
       break;
     }
-
-    V[0] = 0.0;
-    V[0].Add(1.0 / beta, r);
-    std::fill(s.begin(), s.end(), 0.0);
-    s[0] = beta;
-
-    int j = 0;
-    for (;; j++, it++)
+    constexpr double drop_tol = 1.0e-12;
+    std::vector<int> keep;
+    for (int j = 0; j < m; j++)
     {
-      if (print_opts.iterations)
+      if (lambda(j) > drop_tol * lambda(m - 1))
       {
-        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
-                   std::string(tab_width, ' '), it, int_width, restart, beta);
+        keep.push_back(j);
       }
-      VecType &w = V[j + 1];
-      if (w.Size() == 0)
+    }
+    const int k = static_cast<int>(keep.size());
+    MatType T(m, k);
+    for (int j = 0; j < k; j++)
+    {
+      T.col(j) = eig.eigenvectors().col(keep[j]) / std::sqrt(lambda(keep[j]));
+    }
+    for (auto *V : {&P, &Q})
+    {
+      for (int j = 0; j < k; j++)
       {
-        Update(j);
+        Z[j] = 0.0;
+        for (int i = 0; i < m; i++)
+        {
+          Z[j].Add(T(i, j), (*V)[i]);
+        }
       }
-      ApplyBA(pc_side, A, B, V[j], w, r, this->use_timer);
-
-      ScalarType *Hj = H.data() + j * (max_dim + 1);
-      OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
-      Hj[j + 1] = linalg::Norml2(comm, w);
-      w *= 1.0 / Hj[j + 1];
+      V->swap(Z);
+    }
+    m = k;
 
-      for (int k = 0; k < j; k++)
+    // Update the solution and residual of each active system, α = Pᴴ R.
+    const int n_active = static_cast<int>(active.size());
+    MatType alpha(m, n_active);
+    for (int c = 0; c < n_active; c++)
+    {
+      linalg::LocalDots(R[active[c]], P, alpha.col(c).data(), m);
+    }
+    Mpi::GlobalSum(m * n_active, alpha.data(), comm);
+    for (int c = 0; c < n_active; c++)
+    {
+      for (int j = 0; j < m; j++)
       {
-        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
+        x[active[c]].Add(alpha(j, c), P[j]);
+        R[active[c]].Add(-alpha(j, c), Q[j]);
       }
-      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
-      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
-      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
-
-      beta = std::abs(s[j + 1]);
-      CheckDot(beta, "GMRES residual norm is not valid: beta = ");
-      converged = (beta < eps);
-      if (converged || j + 1 == max_dim || it + 1 == max_it)
+      dots[c] = linalg::LocalDot(R[active[c]], R[active[c]]);
+    }
+    Mpi::GlobalSum(n_active, dots.data(), comm);
+    std::vector<int> next_active;
+    for (int c = 0; c < n_active; c++)
+    {
+      res[active[c]] = std::sqrt(std::abs(dots[c]));
+      if (res[active[c]] >= eps[active[c]])
       {
-        it++;
-        break;
+        next_active.push_back(active[c]);
       }
     }
+    active = std::move(next_active);
+    if (active.empty())
+    {
+      it++;
+      break;
+    }
 
-    // Reconstruct the solution (for restart or due to convergence or maximum iterations).
-    for (int i = j; i >= 0; i--)
+    // Next search directions for the remaining systems, Z + P β with β = -Qᴴ Z such that
+    // they are A-orthogonal to the current ones.
+    const int n_next = static_cast<int>(active.size());
+    for (int c = 0; c < n_next; c++)
     {
-      ScalarType *Hi = H.data() + i * (max_dim + 1);
-      s[i] /= Hi[i];
-      for (int k = i - 1; k >= 0; k--)
+      if (B)
       {
-        s[k] -= Hi[k] * s[i];
+        ApplyB(B, R[active[c]], Z[c], this->use_timer);
       }
-    }
-    if (!B || pc_side == PrecSide::LEFT)
-    {
-      for (int k = 0; k <= j; k++)
+      else
       {
-        x.Add(s[k], V[k]);
+        Z[c] = R[active[c]];
       }
     }
-    else  // B && pc_side == PrecSide::RIGHT
+    MatType beta(m, n_next);
+    for (int c = 0; c < n_next; c++)
     {
-      r = 0.0;
-      for (int k = 0; k <= j; k++)
-      {
-        r.Add(s[k], V[k]);
-      }
-      ApplyB(B, r, V[0], this->use_timer);
-      x += V[0];
+      linalg::LocalDots(Z[c], Q, beta.col(c).data(), m);
     }
-    if (converged)
+    Mpi::GlobalSum(m * n_next, beta.data(), comm);
+    for (int c = 0; c < n_next; c++)
     {
-      break;
+      for (int j = 0; j < m; j++)
+      {
+        Z[c].Add(-beta(j, c), P[j]);
+      }
     }
+    P.swap(Z);
+    m = n_next;
   }
+  converged = active.empty();
+  final_res = ResidualNorm();
   if (print_opts.iterations)
   {
-    Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
-               std::string(tab_width, ' '), it, int_width, restart, beta);
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||R||_F = {:.6e} ({:d} active)\n",
+               std::string(tab_width, ' '), it, int_width, final_res, active.size());
   }
-  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  if (breakdown && print_opts.warnings)
   {
-    Mpi::Print(comm, "{}GMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
-               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    Mpi::Print(comm, "{}Block PCG operator is not positive definite at iteration {:d}!\n",
+               std::string(tab_width, ' '), it);
+  }
+  if (print_opts.summary || (print_opts.warnings && !converged))
+  {
+    Mpi::Print(comm, "{}Block PCG solver {} in {:d} iteration{}",
+               std::string(tab_width, ' '), converged ? "converged" : "did NOT converge",
+               it, (it == 1) ? "" : "s");
     if (it > 0)
     {
       Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
-                 std::pow(beta / initial_res, 1.0 / it));
+                 std::pow(final_res / initial_res, 1.0 / it));
     }
     else
     {
       Mpi::Print(comm, "\n");
     }
   }
-  final_res = beta;
   final_it = it;
 }
 
 template <typename OperType>
-void FgmresSolver<OperType>::Initialize() const
+void CocgSolver<OperType>::Mult(const VecType &b, VecType &x) const
 {
-  GmresSolver<OperType>::Initialize();
-  constexpr int init_size = 5;
-  Z.resize(max_dim + 1);
-  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+  // Set up workspace.
+  ScalarType rho, rho_prev = 0.0, alpha, denom;
+  RealType res, eps;
+  MFEM_VERIFY(A, "Operator must be set for CocgSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for CocgSolver::Mult!");
+  r.SetSize(A->Height());
+  z.SetSize(A->Height());
+  p.SetSize(A->Height());
+  q.SetSize(A->Height());
+  r.UseDevice(true);
+  z.UseDevice(true);
+  p.UseDevice(true);
+  q.UseDevice(true);
+
+  // Initialize. The residual norm and the indefinite inner product (Br)ᵀ r share a single
+  // global reduction.
+  if (this->initial_guess)
   {
-    Z[j].SetSize(A->Height());
-    Z[j].UseDevice(true);
+    A->Mult(x, r);
+    linalg::AXPBY(1.0, b, -1.0, r);
   }
-}
-
-template <typename OperType>
-void FgmresSolver<OperType>::Update(int j) const
-{
-  // Add storage for basis vectors in increments.
-  GmresSolver<OperType>::Update(j);
-  constexpr int add_size = 10;
-  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  else
   {
-    Z[k].SetSize(A->Height());
-    Z[k].UseDevice(true);
+    r = b;
+    x = 0.0;
   }
-}
-
-template <typename OperType>
-void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
-{
-  // Set up workspace.
-  RealType beta = 0.0, true_beta, eps = 0.0;
-  MFEM_VERIFY(A && B, "Operator and preconditioner must be set for FgmresSolver::Mult!");
-  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
-              "Size mismatch for FgmresSolver::Mult!");
-  Initialize();
+  if (B)
+  {
+    ApplyB(B, r, z, this->use_timer);
+  }
+  else
+  {
+    z = r;
+  }
+  ScalarType dots[2] = {LocalTransposeDot(z, r), linalg::LocalDot(r, r)};
+  Mpi::GlobalSum(2, dots, comm);
+  rho = dots[0];
+  res = std::sqrt(std::abs(dots[1]));
+  initial_res = this->initial_guess ? linalg::Norml2(comm, b) : res;
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
 
   // Begin iterations.
-  converged = false;
-  int it = 0, restart = 0;
+  int it = 0;
+  bool breakdown = false;
   if (print_opts.iterations)
   {
-    Mpi::Print(comm, "{}Residual norms for FGMRES solve\n",
+    Mpi::Print(comm, "{}Residual norms for COCG solve\n",
                std::string(tab_width + int_width - 1, ' '));
   }
-  for (; it < max_it; restart++)
+  for (; it < max_it && !converged; it++)
+  {
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+    if (IsBreakdown(rho))
+    {
+      breakdown = true;
+      break;
+    }
+    if (!it)
+    {
+      p = z;
+    }
+    else
+    {
+      linalg::AXPBY(ScalarType(1.0), z, rho / rho_prev, p);
+    }
+
+    A->Mult(p, q);
+    denom = TransposeDot(comm, q, p);
+    if (IsBreakdown(denom))
+    {
+      breakdown = true;
+      break;
+    }
+    alpha = rho / denom;
+
+    x.Add(alpha, p);
+    r.Add(-alpha, q);
+
+    rho_prev = rho;
+    if (B)
+    {
+      ApplyB(B, r, z, this->use_timer);
+    }
+    else
+    {
+      z = r;
+    }
+    dots[0] = LocalTransposeDot(z, r);
+    dots[1] = linalg::LocalDot(r, r);
+    Mpi::GlobalSum(2, dots, comm);
+    rho = dots[0];
+    res = std::sqrt(std::abs(dots[1]));
+    converged = (res < eps);
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (breakdown && print_opts.warnings)
+  {
+    Mpi::Print(comm, "{}COCG solver breakdown at iteration {:d}!\n",
+               std::string(tab_width, ' '), it);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}COCG solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void CocrSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  ScalarType rho, rho_prev = 0.0, alpha, denom;
+  RealType res, eps;
+  MFEM_VERIFY(A, "Operator must be set for CocrSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for CocrSolver::Mult!");
+  r.SetSize(A->Height());
+  z.SetSize(A->Height());
+  p.SetSize(A->Height());
+  Az.SetSize(A->Height());
+  Ap.SetSize(A->Height());
+  r.UseDevice(true);
+  z.UseDevice(true);
+  p.UseDevice(true);
+  Az.UseDevice(true);
+  Ap.UseDevice(true);
+  if (B)
+  {
+    u.SetSize(A->Height());
+    u.UseDevice(true);
+  }
+
+  // Initialize.
+  if (this->initial_guess)
+  {
+    A->Mult(x, r);
+    linalg::AXPBY(1.0, b, -1.0, r);
+  }
+  else
+  {
+    r = b;
+    x = 0.0;
+  }
+  if (B)
+  {
+    ApplyB(B, r, z, this->use_timer);
+  }
+  else
+  {
+    z = r;
+  }
+  A->Mult(z, Az);
+  ScalarType dots[2] = {LocalTransposeDot(Az, z), linalg::LocalDot(r, r)};
+  Mpi::GlobalSum(2, dots, comm);
+  rho = dots[0];
+  res = std::sqrt(std::abs(dots[1]));
+  initial_res = this->initial_guess ? linalg::Norml2(comm, b) : res;
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+
+  // Begin iterations.
+  int it = 0;
+  bool breakdown = false;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for COCR solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it && !converged; it++)
+  {
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+    if (IsBreakdown(rho))
+    {
+      breakdown = true;
+      break;
+    }
+    if (!it)
+    {
+      p = z;
+      Ap = Az;
+    }
+    else
+    {
+      linalg::AXPBY(ScalarType(1.0), z, rho / rho_prev, p);
+      linalg::AXPBY(ScalarType(1.0), Az, rho / rho_prev, Ap);
+    }
+
+    // Without a preconditioner, u = Ap and the update of z mirrors that of r.
+    const VecType *pu = &Ap;
+    if (B)
+    {
+      ApplyB(B, Ap, u, this->use_timer);
+      pu = &u;
+    }
+    denom = TransposeDot(comm, *pu, Ap);
+    if (IsBreakdown(denom))
+    {
+      breakdown = true;
+      break;
+    }
+    alpha = rho / denom;
+
+    x.Add(alpha, p);
+    r.Add(-alpha, Ap);
+    z.Add(-alpha, *pu);
+
+    rho_prev = rho;
+    A->Mult(z, Az);
+    dots[0] = LocalTransposeDot(Az, z);
+    dots[1] = linalg::LocalDot(r, r);
+    Mpi::GlobalSum(2, dots, comm);
+    rho = dots[0];
+    res = std::sqrt(std::abs(dots[1]));
+    converged = (res < eps);
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (breakdown && print_opts.warnings)
+  {
+    Mpi::Print(comm, "{}COCR solver breakdown at iteration {:d}!\n",
+               std::string(tab_width, ' '), it);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}COCR solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void MinresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace. See Paige and Saunders, Solution of sparse indefinite systems of
+  // linear equations, SIAM J. Numer. Anal. (1975). The Lanczos coefficients and plane
+  // rotations are real also for Hermitian complex-valued systems.
+  RealType beta, beta_prev = 0.0, alpha, delta, gbar, gamma, epsln = 0.0, epsln_prev;
+  RealType dbar = 0.0, phi, phibar, cs = -1.0, sn = 0.0, res, eps;
+  MFEM_VERIFY(A, "Operator must be set for MinresSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for MinresSolver::Mult!");
+  r1.SetSize(A->Height());
+  r2.SetSize(A->Height());
+  y.SetSize(A->Height());
+  v.SetSize(A->Height());
+  w1.SetSize(A->Height());
+  w2.SetSize(A->Height());
+  r1.UseDevice(true);
+  r2.UseDevice(true);
+  y.UseDevice(true);
+  v.UseDevice(true);
+  w1.UseDevice(true);
+  w2.UseDevice(true);
+
+  // Initialize.
+  if (this->initial_guess)
+  {
+    A->Mult(x, r1);
+    linalg::AXPBY(1.0, b, -1.0, r1);
+  }
+  else
+  {
+    r1 = b;
+    x = 0.0;
+  }
+  if (B)
+  {
+    ApplyB(B, r1, y, this->use_timer);
+  }
+  else
+  {
+    y = r1;
+  }
+  {
+    const auto dot = linalg::Dot(comm, y, r1);
+    CheckDot(dot, "MINRES preconditioner is not positive definite: (Br, r) = ");
+    beta = std::sqrt(std::abs(dot));
+  }
+  r2 = r1;
+  w1 = 0.0;
+  w2 = 0.0;
+  res = phibar = beta;
+  if (this->initial_guess)
+  {
+    ScalarType beta_rhs;
+    if (B)
+    {
+      ApplyB(B, b, v, this->use_timer);
+      beta_rhs = linalg::Dot(comm, v, b);
+    }
+    else
+    {
+      beta_rhs = linalg::Norml2(comm, b);
+    }
+    CheckDot(beta_rhs, "MINRES preconditioner is not positive definite: (Bb, b) = ");
+    initial_res = std::sqrt(std::abs(beta_rhs));
+  }
+  else
+  {
+    initial_res = res;
+  }
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+
+  // Begin iterations. The three-term Lanczos recurrence and the solution update rotate
+  // through fixed storage rather than copying vectors.
+  VecType *pr1 = &r1, *pr2 = &r2, *py = &y, *pw1 = &w1, *pw2 = &w2;
+  int it = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for MINRES solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it && !converged; it++)
+  {
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+
+    // Lanczos step.
+    v = *py;
+    v *= 1.0 / beta;
+    A->Mult(v, *py);
+    if (it > 0)
+    {
+      py->Add(-beta / beta_prev, *pr1);
+    }
+    alpha = std::real(linalg::Dot(comm, *py, v));
+    py->Add(-alpha / beta, *pr2);
+    std::swap(pr1, pr2);
+    std::swap(pr2, py);
+    if (B)
+    {
+      ApplyB(B, *pr2, *py, this->use_timer);
+    }
+    else
+    {
+      *py = *pr2;
+    }
+    beta_prev = beta;
+    {
+      const auto dot = linalg::Dot(comm, *py, *pr2);
+      CheckDot(dot, "MINRES preconditioner is not positive definite: (Br, r) = ");
+      beta = std::sqrt(std::abs(dot));
+    }
+
+    // Apply the previous plane rotation and generate the next one.
+    epsln_prev = epsln;
+    delta = cs * dbar + sn * alpha;
+    gbar = sn * dbar - cs * alpha;
+    epsln = sn * beta;
+    dbar = -cs * beta;
+    gamma = std::max(std::hypot(gbar, beta), SafeMin<RealType>());
+    cs = gbar / gamma;
+    sn = beta / gamma;
+    phi = cs * phibar;
+    phibar = sn * phibar;
+
+    // Update the solution, w = (v - ε w₁ - δ w₂) / γ overwrites the oldest direction.
+    linalg::AXPBYPCZ(1.0 / gamma, v, -delta / gamma, *pw2, -epsln_prev / gamma, *pw1);
+    x.Add(phi, *pw1);
+    std::swap(pw1, pw2);
+
+    res = std::abs(phibar);
+    converged = (res < eps);
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}MINRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void GmresSolver<OperType>::Initialize() const
+{
+  if (!V.empty())
+  {
+    MFEM_ASSERT(V.size() == static_cast<std::size_t>(max_dim + 1) &&
+                    V[0].Size() == A->Height(),
+                "Repeated solves with GmresSolver should not modify the operator size or "
+                "restart dimension!");
+    return;
+  }
+  if (max_dim < 0)
+  {
+    max_dim = max_it;
+  }
+  constexpr int init_size = 5;
+  V.resize(max_dim + 1);
+  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+  {
+    V[j].SetSize(A->Height());
+    V[j].UseDevice(true);
+  }
+  H.resize((max_dim + 1) * max_dim);
+  s.resize(max_dim + 1);
+  cs.resize(max_dim + 1);
+  sn.resize(max_dim + 1);
+}
+
+template <typename OperType>
+void GmresSolver<OperType>::Update(int j) const
+{
+  // Add storage for basis vectors in increments.
+  constexpr int add_size = 10;
+  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  {
+    V[k].SetSize(A->Height());
+    V[k].UseDevice(true);
+  }
+}
+
+template <typename OperType>
+void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  RealType beta = 0.0, true_beta, eps = 0.0;
+  MFEM_VERIFY(A, "Operator must be set for GmresSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for GmresSolver::Mult!");
+  r.SetSize(A->Height());
+  r.UseDevice(true);
+  Initialize();
+
+  // Begin iterations.
+  converged = false;
+  int it = 0, restart = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for GMRES solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it; restart++)
+  {
+    // Initialize.
+    InitialResidual(pc_side, A, B, b, x, r, V[0], (this->initial_guess || restart > 0),
+                    this->use_timer);
+    true_beta = linalg::Norml2(comm, r);
+    CheckDot(true_beta, "GMRES residual norm is not valid: beta = ");
+    if (it == 0)
+    {
+      if (this->initial_guess)
+      {
+        RealType beta_rhs;
+        if (B && pc_side == PrecSide::LEFT)
+        {
+          ApplyB(B, b, V[0], this->use_timer);
+          beta_rhs = linalg::Norml2(comm, V[0]);
+        }
+        else  // !B || pc_side == PrecSide::RIGHT
+        {
+          beta_rhs = linalg::Norml2(comm, b);
+        }
+        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
+        initial_res = beta_rhs;
+      }
+      else
+      {
+        initial_res = true_beta;
+      }
+      eps = std::max(rel_tol * initial_res, abs_tol);
+    }
+    else if (beta > 0.0 && std::abs(beta - true_beta) > 0.1 * true_beta &&
+             print_opts.warnings)
+    {
+      Mpi::Print(
+          comm,
+          "{}GMRES residual at restart ({:.6e}) is far from the residual norm estimate "
+          "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
+          std::string(tab_width, ' '), true_beta, beta, initial_res);
+    }
+    beta = true_beta;
+    if (beta < eps)
+    {
+      converged = true;
+      break;
+    }
+
+    V[0] = 0.0;
+    V[0].Add(1.0 / beta, r);
+    std::fill(s.begin(), s.end(), 0.0);
+    s[0] = beta;
+
+    int j = 0;
+    for (;; j++, it++)
+    {
+      if (print_opts.iterations)
+      {
+        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+                   std::string(tab_width, ' '), it, int_width, restart, beta);
+      }
+      VecType &w = V[j + 1];
+      if (w.Size() == 0)
+      {
+        Update(j);
+      }
+      ApplyBA(pc_side, A, B, V[j], w, r, this->use_timer);
+
+      ScalarType *Hj = H.data() + j * (max_dim + 1);
+      Hj[j + 1] = OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
+      w *= 1.0 / Hj[j + 1];
+
+      for (int k = 0; k < j; k++)
+      {
+        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
+      }
+      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
+
+      beta = std::abs(s[j + 1]);
+      CheckDot(beta, "GMRES residual norm is not valid: beta = ");
+      converged = (beta < eps);
+      if (converged || j + 1 == max_dim || it + 1 == max_it)
+      {
+        it++;
+        break;
+      }
+    }
+
+    // Reconstruct the solution (for restart or due to convergence or maximum iterations).
+    for (int i = j; i >= 0; i--)
+    {
+      ScalarType *Hi = H.data() + i * (max_dim + 1);
+      s[i] /= Hi[i];
+      for (int k = i - 1; k >= 0; k--)
+      {
+        s[k] -= Hi[k] * s[i];
+      }
+    }
+    if (!B || pc_side == PrecSide::LEFT)
+    {
+      for (int k = 0; k <= j; k++)
+      {
+        x.Add(s[k], V[k]);
+      }
+    }
+    else  // B && pc_side == PrecSide::RIGHT
+    {
+      r = 0.0;
+      for (int k = 0; k <= j; k++)
+      {
+        r.Add(s[k], V[k]);
+      }
+      ApplyB(B, r, V[0], this->use_timer);
+      x += V[0];
+    }
+    if (converged)
+    {
+      break;
+    }
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, restart, beta);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}GMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(beta / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = beta;
+  final_it = it;
+}
+
+template <typename OperType>
+void FgmresSolver<OperType>::Initialize() const
+{
+  GmresSolver<OperType>::Initialize();
+  constexpr int init_size = 5;
+  Z.resize(max_dim + 1);
+  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+  {
+    Z[j].SetSize(A->Height());
+    Z[j].UseDevice(true);
+  }
+}
+
+template <typename OperType>
+void FgmresSolver<OperType>::Update(int j) const
+{
+  // Add storage for basis vectors in increments.
+  GmresSolver<OperType>::Update(j);
+  constexpr int add_size = 10;
+  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  {
+    Z[k].SetSize(A->Height());
+    Z[k].UseDevice(true);
+  }
+}
+
+template <typename OperType>
+void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  RealType beta = 0.0, true_beta, eps = 0.0;
+  MFEM_VERIFY(A && B, "Operator and preconditioner must be set for FgmresSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for FgmresSolver::Mult!");
+  Initialize();
+
+  // Begin iterations.
+  converged = false;
+  int it = 0, restart = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for FGMRES solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it; restart++)
   {
     // Initialize.
     InitialResidual(PrecSide::RIGHT, A, B, b, x, Z[0], V[0],
@@ -742,16 +1456,365 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     CheckDot(true_beta, "FGMRES residual norm is not valid: beta = ");
     if (it == 0)
     {
-      if (this->initial_guess)
+      if (this->initial_guess)
+      {
+        auto beta_rhs = linalg::Norml2(comm, b);
+        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
+        initial_res = beta_rhs;
+      }
+      else
+      {
+        initial_res = true_beta;
+      }
+      eps = std::max(rel_tol * initial_res, abs_tol);
+    }
+    else if (beta > 0.0 && std::abs(beta - true_beta) > 0.1 * true_beta &&
+             print_opts.warnings)
+    {
+      Mpi::Print(
+          comm,
+          "{}FGMRES residual at restart ({:.6e}) is far from the residual norm estimate "
+          "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
+          std::string(tab_width, ' '), true_beta, beta, initial_res);
+    }
+    beta = true_beta;
+    if (beta < eps)
+    {
+      converged = true;
+      break;
+    }
+
+    V[0] = 0.0;
+    V[0].Add(1.0 / beta, Z[0]);
+    std::fill(s.begin(), s.end(), 0.0);
+    s[0] = beta;
+
+    int j = 0;
+    for (;; j++, it++)
+    {
+      if (print_opts.iterations)
+      {
+        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+                   std::string(tab_width, ' '), it, int_width, restart, beta);
+      }
+      VecType &w = V[j + 1];
+      if (w.Size() == 0)
+      {
+        Update(j);
+      }
+      ApplyBA(PrecSide::RIGHT, A, B, V[j], w, Z[j], this->use_timer);
+
+      ScalarType *Hj = H.data() + j * (max_dim + 1);
+      Hj[j + 1] = OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
+      w *= 1.0 / Hj[j + 1];
+
+      for (int k = 0; k < j; k++)
+      {
+        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
+      }
+      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
+
+      beta = std::abs(s[j + 1]);
+      CheckDot(beta, "FGMRES residual norm is not valid: beta = ");
+      converged = (beta < eps);
+      if (converged || j + 1 == max_dim || it + 1 == max_it)
+      {
+        it++;
+        break;
+      }
+    }
+
+    // Reconstruct the solution (for restart or due to convergence or maximum iterations).
+    for (int i = j; i >= 0; i--)
+    {
+      ScalarType *Hi = H.data() + i * (max_dim + 1);
+      s[i] /= Hi[i];
+      for (int k = i - 1; k >= 0; k--)
+      {
+        s[k] -= Hi[k] * s[i];
+      }
+    }
+    for (int k = 0; k <= j; k++)
+    {
+      x.Add(s[k], Z[k]);
+    }
+    if (converged)
+    {
+      break;
+    }
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, restart, beta);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}FGMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(beta / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = beta;
+  final_it = it;
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::Initialize() const
+{
+  GmresSolver<OperType>::Initialize();
+  if (!Hbar.empty())
+  {
+    return;
+  }
+  Hbar.resize((max_dim + 1) * max_dim);
+  if (max_recycle_dim > 0)
+  {
+    Bk.resize(max_recycle_dim * max_dim);
+    U.resize(max_recycle_dim);
+    C.resize(max_recycle_dim);
+    T.resize(max_recycle_dim);
+    for (int i = 0; i < max_recycle_dim; i++)
+    {
+      U[i].SetSize(A->Height());
+      C[i].SetSize(A->Height());
+      T[i].SetSize(A->Height());
+      U[i].UseDevice(true);
+      C[i].UseDevice(true);
+      T[i].UseDevice(true);
+    }
+  }
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::UpdateRecycleOperator() const
+{
+  // Compute C = A B U and its thin QR factorization C = Q R, then set C ← Q and U ← U R⁻¹.
+  // Directions which become (numerically) linearly dependent are discarded along with all
+  // following ones.
+  constexpr double drop_tol = 1.0e-12;
+  std::vector<ScalarType> Rj(recycle_dim);
+  for (int j = 0; j < recycle_dim; j++)
+  {
+    ApplyBA(PrecSide::RIGHT, A, B, U[j], C[j], r, this->use_timer);
+    const auto norm0 = linalg::Norml2(comm, C[j]);
+    linalg::OrthogonalizeColumnCGS(comm, C, C[j], Rj.data(), j, true);
+    const auto norm = linalg::Norml2(comm, C[j]);
+    if (!(norm > drop_tol * norm0))
+    {
+      recycle_dim = j;
+      break;
+    }
+    C[j] *= 1.0 / norm;
+    for (int i = 0; i < j; i++)
+    {
+      U[j].Add(-Rj[i], U[i]);
+    }
+    U[j] *= 1.0 / norm;
+  }
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::UpdateRecycleSpace(int m) const
+{
+  // The Arnoldi relation for the last cycle is A B Ŵ = W G, with Ŵ = [U, V_m],
+  // W = [C, V_{m+1}], and G = [I, B_k; 0, H̄_m]. The harmonic Ritz vectors solve
+  // Gᴴ G z = θ Gᴴ Wᴴ Ŵ z, where Wᴴ Ŵ = [Cᴴ U, 0; V_{m+1}ᴴ U, I_{m+1,m}]. Without a
+  // recycled subspace this reduces to the deflation used by GMRES-DR.
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  const int k = recycle_dim, n = k + m;
+  MatType G = MatType::Zero(n + 1, n), WW = MatType::Zero(n + 1, n);
+  for (int i = 0; i < k; i++)
+  {
+    G(i, i) = 1.0;
+  }
+  for (int j = 0; j < m; j++)
+  {
+    for (int i = 0; i < k; i++)
+    {
+      G(i, k + j) = Bk[j * max_recycle_dim + i];
+    }
+    for (int i = 0; i <= j + 1; i++)
+    {
+      G(k + i, k + j) = Hbar[j * (max_dim + 1) + i];
+    }
+    WW(k + j, k + j) = 1.0;
+  }
+  if (k > 0)
+  {
+    std::vector<ScalarType> dots(k * (n + 1));
+    for (int j = 0; j < k; j++)
+    {
+      linalg::LocalDots(U[j], C, dots.data() + j * (n + 1), k);
+      linalg::LocalDots(U[j], V, dots.data() + j * (n + 1) + k, m + 1);
+    }
+    Mpi::GlobalSum(k * (n + 1), dots.data(), comm);
+    for (int j = 0; j < k; j++)
+    {
+      for (int i = 0; i <= n; i++)
       {
-        auto beta_rhs = linalg::Norml2(comm, b);
-        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
-        initial_res = beta_rhs;
+        WW(i, j) = dots[j * (n + 1) + i];
       }
-      else
+    }
+  }
+
+  // Solve the small eigenvalue problem and sort the harmonic Ritz values by magnitude.
+  const Eigen::MatrixXcd Gc = G.template cast<std::complex<double>>();
+  const Eigen::MatrixXcd Mc =
+      (Gc.adjoint() * WW.template cast<std::complex<double>>())
+          .partialPivLu()
+          .solve(Gc.adjoint() * Gc);
+  Eigen::ComplexEigenSolver<Eigen::MatrixXcd> eig(Mc);
+  if (eig.info() != Eigen::Success)
+  {
+    return;
+  }
+  const auto &theta = eig.eigenvalues();
+  std::vector<int> perm(n);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::sort(perm.begin(), perm.end(),
+            [&theta](int i1, int i2) { return std::abs(theta(i1)) < std::abs(theta(i2)); });
+
+  // Collect the coefficients of the new recycled subspace. For real-valued systems, the
+  // real and imaginary parts of a complex conjugate pair of eigenvectors span the same
+  // space as the pair.
+  constexpr double imag_tol = 1.0e-12;
+  const int k_new = std::min(max_recycle_dim, n);
+  MatType P(n, k_new);
+  int c = 0;
+  for (int i = 0; i < n && c < k_new; i++)
+  {
+    Eigen::VectorXcd z = eig.eigenvectors().col(perm[i]);
+    Eigen::Index imax;
+    z.cwiseAbs().maxCoeff(&imax);
+    z /= z(imax);
+    if constexpr (std::is_same<ScalarType, RealType>::value)
+    {
+      const bool is_real =
+          std::abs(theta(perm[i]).imag()) <= imag_tol * std::abs(theta(perm[i]));
+      if (!is_real && theta(perm[i]).imag() < 0.0)
       {
-        initial_res = true_beta;
+        continue;
+      }
+      P.col(c++) = z.real();
+      if (!is_real && c < k_new)
+      {
+        P.col(c++) = z.imag();
+      }
+    }
+    else
+    {
+      P.col(c++) = z;
+    }
+  }
+
+  if (c == 0)
+  {
+    return;
+  }
+
+  // Orthonormalize the image: G P = Q R, so the new C = W Q and the new U = Ŵ P R⁻¹.
+  Eigen::HouseholderQR<MatType> qr(G * P.leftCols(c));
+  const MatType Q = qr.householderQ() * MatType::Identity(n + 1, c);
+  MatType R = qr.matrixQR().topLeftCorner(c, c).template triangularView<Eigen::Upper>();
+  constexpr double drop_tol = 1.0e-12;
+  int k_rank = 0;
+  while (k_rank < c && std::abs(R(k_rank, k_rank)) > drop_tol * std::abs(R(0, 0)))
+  {
+    k_rank++;
+  }
+  const MatType Pt = R.topLeftCorner(k_rank, k_rank)
+                         .template triangularView<Eigen::Upper>()
+                         .template solve<Eigen::OnTheRight>(P.leftCols(k_rank));
+  for (int j = 0; j < k_rank; j++)
+  {
+    T[j] = 0.0;
+    for (int i = 0; i < k; i++)
+    {
+      T[j].Add(Q(i, j), C[i]);
+    }
+    for (int i = 0; i <= m; i++)
+    {
+      T[j].Add(Q(k + i, j), V[i]);
+    }
+  }
+  C.swap(T);
+  for (int j = 0; j < k_rank; j++)
+  {
+    T[j] = 0.0;
+    for (int i = 0; i < k; i++)
+    {
+      T[j].Add(Pt(i, j), U[i]);
+    }
+    for (int i = 0; i < m; i++)
+    {
+      T[j].Add(Pt(k + i, j), V[i]);
+    }
+  }
+  U.swap(T);
+  recycle_dim = k_rank;
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  RealType beta = 0.0, true_beta, eps = 0.0;
+  MFEM_VERIFY(A, "Operator must be set for GcroDrSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for GcroDrSolver::Mult!");
+  r.SetSize(A->Height());
+  t.SetSize(A->Height());
+  r.UseDevice(true);
+  t.UseDevice(true);
+  Initialize();
+  if (update_recycle)
+  {
+    UpdateRecycleOperator();
+    update_recycle = false;
+  }
+  std::vector<ScalarType> d(recycle_dim);
+
+  // Begin iterations.
+  converged = false;
+  int it = 0, restart = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for GCRO-DR solve (recycled dimension {:d})\n",
+               std::string(tab_width + int_width - 1, ' '), recycle_dim);
+  }
+  for (; it < max_it; restart++)
+  {
+    // Initialize. The residual is projected onto the orthogonal complement of range(C),
+    // with the corresponding correction U Cᴴ r accumulated in t.
+    InitialResidual(PrecSide::RIGHT, A, B, b, x, r, V[0],
+                    (this->initial_guess || restart > 0), this->use_timer);
+    t = 0.0;
+    if (recycle_dim > 0)
+    {
+      d.resize(recycle_dim);
+      OrthogonalizeIteration(orthog_type, comm, C, r, d.data(), recycle_dim - 1);
+      for (int i = 0; i < recycle_dim; i++)
+      {
+        t.Add(d[i], U[i]);
       }
+    }
+    true_beta = linalg::Norml2(comm, r);
+    CheckDot(true_beta, "GCRO-DR residual norm is not valid: beta = ");
+    if (it == 0)
+    {
+      auto beta_rhs = linalg::Norml2(comm, b);
+      CheckDot(beta_rhs, "GCRO-DR residual norm is not valid: beta_rhs = ");
+      initial_res = beta_rhs;
       eps = std::max(rel_tol * initial_res, abs_tol);
     }
     else if (beta > 0.0 && std::abs(beta - true_beta) > 0.1 * true_beta &&
@@ -759,19 +1822,28 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     {
       Mpi::Print(
           comm,
-          "{}FGMRES residual at restart ({:.6e}) is far from the residual norm estimate "
+          "{}GCRO-DR residual at restart ({:.6e}) is far from the residual norm estimate "
           "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
           std::string(tab_width, ' '), true_beta, beta, initial_res);
     }
     beta = true_beta;
     if (beta < eps)
     {
+      if (recycle_dim > 0 && B)
+      {
+        ApplyB(B, t, V[0], this->use_timer);
+        x += V[0];
+      }
+      else if (recycle_dim > 0)
+      {
+        x += t;
+      }
       converged = true;
       break;
     }
 
     V[0] = 0.0;
-    V[0].Add(1.0 / beta, Z[0]);
+    V[0].Add(1.0 / beta, r);
     std::fill(s.begin(), s.end(), 0.0);
     s[0] = beta;
 
@@ -786,14 +1858,21 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
       VecType &w = V[j + 1];
       if (w.Size() == 0)
       {
-        Update(j);
+        this->Update(j);
       }
-      ApplyBA(PrecSide::RIGHT, A, B, V[j], w, Z[j], this->use_timer);
+      ApplyBA(PrecSide::RIGHT, A, B, V[j], w, r, this->use_timer);
 
+      // Orthogonalize against the image of the recycled subspace, B_k = Cᴴ A B V_m, and
+      // then the Arnoldi basis.
+      if (recycle_dim > 0)
+      {
+        ScalarType *Bj = Bk.data() + j * max_recycle_dim;
+        OrthogonalizeIteration(orthog_type, comm, C, w, Bj, recycle_dim - 1);
+      }
       ScalarType *Hj = H.data() + j * (max_dim + 1);
-      OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
-      Hj[j + 1] = linalg::Norml2(comm, w);
+      Hj[j + 1] = OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
       w *= 1.0 / Hj[j + 1];
+      std::copy_n(Hj, j + 2, Hbar.data() + j * (max_dim + 1));
 
       for (int k = 0; k < j; k++)
       {
@@ -804,7 +1883,7 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
       ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
 
       beta = std::abs(s[j + 1]);
-      CheckDot(beta, "FGMRES residual norm is not valid: beta = ");
+      CheckDot(beta, "GCRO-DR residual norm is not valid: beta = ");
       converged = (beta < eps);
       if (converged || j + 1 == max_dim || it + 1 == max_it)
       {
@@ -813,7 +1892,8 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
       }
     }
 
-    // Reconstruct the solution (for restart or due to convergence or maximum iterations).
+    // Reconstruct the solution, x += B (V_m y - U B_k y) with the accumulated projection
+    // correction.
     for (int i = j; i >= 0; i--)
     {
       ScalarType *Hi = H.data() + i * (max_dim + 1);
@@ -825,7 +1905,32 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     }
     for (int k = 0; k <= j; k++)
     {
-      x.Add(s[k], Z[k]);
+      t.Add(s[k], V[k]);
+    }
+    for (int i = 0; i < recycle_dim; i++)
+    {
+      ScalarType z = 0.0;
+      for (int k = 0; k <= j; k++)
+      {
+        z += Bk[k * max_recycle_dim + i] * s[k];
+      }
+      t.Add(-z, U[i]);
+    }
+    if (B)
+    {
+      ApplyB(B, t, r, this->use_timer);
+      x += r;
+    }
+    else
+    {
+      x += t;
+    }
+
+    // Deflate using the harmonic Ritz vectors from this cycle, which are also retained for
+    // subsequent calls to Mult.
+    if (max_recycle_dim > 0)
+    {
+      UpdateRecycleSpace(j + 1);
     }
     if (converged)
     {
@@ -839,8 +1944,9 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
   }
   if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
   {
-    Mpi::Print(comm, "{}FGMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
-               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    Mpi::Print(comm, "{}GCRO-DR solver {} in {:d} iteration{}",
+               std::string(tab_width, ' '), converged ? "converged" : "did NOT converge",
+               it, (it == 1) ? "" : "s");
     if (it > 0)
     {
       Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
@@ -855,13 +1961,211 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
   final_it = it;
 }
 
+template <typename OperType>
+void BiCGStabSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace. See Sleijpen and Fokkema, BiCGstab(l) for linear equations involving
+  // unsymmetric matrices with complex spectrum, ETNA (1993).
+  ScalarType rho0 = 1.0, rho1, alpha = 0.0, omega = 1.0, beta, denom;
+  RealType res, eps;
+  MFEM_VERIFY(A, "Operator must be set for BiCGStabSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for BiCGStabSolver::Mult!");
+  if (R.size() != static_cast<std::size_t>(l + 1))
+  {
+    R.resize(l + 1);
+    U.resize(l + 1);
+  }
+  for (int j = 0; j <= l; j++)
+  {
+    R[j].SetSize(A->Height());
+    U[j].SetSize(A->Height());
+    R[j].UseDevice(true);
+    U[j].UseDevice(true);
+  }
+  r0.SetSize(A->Height());
+  y.SetSize(A->Height());
+  z.SetSize(A->Height());
+  r0.UseDevice(true);
+  y.UseDevice(true);
+  z.UseDevice(true);
+  tau.resize((l + 1) * (l + 1));
+  sigma.resize(l + 1);
+  gamma.resize(l + 1);
+  gamma1.resize(l + 1);
+  gamma2.resize(l + 1);
+
+  // Initialize. With right preconditioning the iteration solves A B y = r for the
+  // correction y, and x += B y at the end.
+  InitialResidual(GmresSolverBase::PrecSide::RIGHT, A, B, b, x, R[0], z,
+                  this->initial_guess, this->use_timer);
+  res = linalg::Norml2(comm, R[0]);
+  initial_res = this->initial_guess ? linalg::Norml2(comm, b) : res;
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+  r0 = R[0];
+  y = 0.0;
+  U[0] = 0.0;
+
+  // Begin iterations. Each cycle consists of ℓ BiCG steps followed by the minimal residual
+  // update, and counts as ℓ iterations. The last cycle is shortened so that the total
+  // number of iterations does not exceed the maximum.
+  int it = 0, lc = l;
+  bool breakdown = false;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for BiCGStab({:d}) solve\n",
+               std::string(tab_width + int_width - 1, ' '), l);
+  }
+  for (; it < max_it && !converged; it += lc)
+  {
+    lc = std::min(l, max_it - it);
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+
+    // BiCG part.
+    rho0 = -omega * rho0;
+    for (int j = 0; j < lc && !breakdown; j++)
+    {
+      rho1 = linalg::Dot(comm, R[j], r0);
+      if (IsBreakdown(rho0))
+      {
+        breakdown = true;
+        break;
+      }
+      beta = alpha * rho1 / rho0;
+      rho0 = rho1;
+      for (int i = 0; i <= j; i++)
+      {
+        linalg::AXPBY(ScalarType(1.0), R[i], -beta, U[i]);
+      }
+      ApplyBA(GmresSolverBase::PrecSide::RIGHT, A, B, U[j], U[j + 1], z, this->use_timer);
+      denom = linalg::Dot(comm, U[j + 1], r0);
+      if (IsBreakdown(denom))
+      {
+        breakdown = true;
+        break;
+      }
+      alpha = rho0 / denom;
+      for (int i = 0; i <= j; i++)
+      {
+        R[i].Add(-alpha, U[i + 1]);
+      }
+      ApplyBA(GmresSolverBase::PrecSide::RIGHT, A, B, R[j], R[j + 1], z, this->use_timer);
+      y.Add(alpha, U[0]);
+    }
+    if (breakdown)
+    {
+      break;
+    }
+
+    // Minimal residual part, using modified Gram-Schmidt on the residuals.
+    for (int j = 1; j <= lc && !breakdown; j++)
+    {
+      for (int i = 1; i < j; i++)
+      {
+        auto &tij = tau[i * (l + 1) + j];
+        tij = linalg::Dot(comm, R[j], R[i]) / sigma[i];
+        R[j].Add(-tij, R[i]);
+      }
+      ScalarType dots[2] = {linalg::LocalDot(R[j], R[j]), linalg::LocalDot(R[0], R[j])};
+      Mpi::GlobalSum(2, dots, comm);
+      sigma[j] = dots[0];
+      breakdown = IsBreakdown(sigma[j]);
+      gamma1[j] = dots[1] / sigma[j];
+    }
+    if (breakdown)
+    {
+      break;
+    }
+    gamma[lc] = omega = gamma1[lc];
+    for (int j = lc - 1; j >= 1; j--)
+    {
+      gamma[j] = gamma1[j];
+      for (int i = j + 1; i <= lc; i++)
+      {
+        gamma[j] -= tau[j * (l + 1) + i] * gamma[i];
+      }
+    }
+    for (int j = 1; j < lc; j++)
+    {
+      gamma2[j] = gamma[j + 1];
+      for (int i = j + 1; i < lc; i++)
+      {
+        gamma2[j] += tau[j * (l + 1) + i] * gamma[i + 1];
+      }
+    }
+    y.Add(gamma[1], R[0]);
+    R[0].Add(-gamma1[lc], R[lc]);
+    U[0].Add(-gamma[lc], U[lc]);
+    for (int j = 1; j < lc; j++)
+    {
+      U[0].Add(-gamma[j], U[j]);
+      y.Add(gamma2[j], R[j]);
+      R[0].Add(-gamma1[j], R[j]);
+    }
+
+    res = linalg::Norml2(comm, R[0]);
+    converged = (res < eps);
+  }
+  if (B)
+  {
+    ApplyB(B, y, z, this->use_timer);
+    x += z;
+  }
+  else
+  {
+    x += y;
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (breakdown && print_opts.warnings)
+  {
+    Mpi::Print(comm, "{}BiCGStab({:d}) solver breakdown at iteration {:d}!\n",
+               std::string(tab_width, ' '), l, it);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}BiCGStab({:d}) solver {} in {:d} iteration{}",
+               std::string(tab_width, ' '), l, converged ? "converged" : "did NOT converge",
+               it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
 template class IterativeSolver<Operator>;
 template class IterativeSolver<ComplexOperator>;
 template class CgSolver<Operator>;
 template class CgSolver<ComplexOperator>;
+template class CocgSolver<Operator>;
+template class CocgSolver<ComplexOperator>;
+template class CocrSolver<Operator>;
+template class CocrSolver<ComplexOperator>;
+template class MinresSolver<Operator>;
+template class MinresSolver<ComplexOperator>;
 template class GmresSolver<Operator>;
 template class GmresSolver<ComplexOperator>;
 template class FgmresSolver<Operator>;
 template class FgmresSolver<ComplexOperator>;
+template class GcroDrSolver<Operator>;
+template class GcroDrSolver<ComplexOperator>;
+template class BiCGStabSolver<Operator>;
+template class BiCGStabSolver<ComplexOperator>;
 
 }  // namespace palace
@@ -135,11 +135,131 @@ protected:
 
   // Temporary workspace for solve.
   mutable VecType r, z, p;
+  mutable std::vector<VecType> R, Z, P, Q;
 
 public:
   CgSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
 
   void Mult(const VecType &b, VecType &x) const override;
+
+  // Block CG for multiple right-hand sides, where the search space at each iteration is
+  // shared among all systems. Each system is considered converged once its own residual
+  // satisfies the tolerance and is then removed from the block, and search directions
+  // which become linearly dependent are dropped. The number of iterations for the solve
+  // refers to the number of block iterations.
+  void Mult(const std::vector<VecType> &b, std::vector<VecType> &x) const;
+};
+
+// Preconditioned Conjugate Orthogonal Conjugate Gradient (COCG) method for complex
+// symmetric (A = Aᵀ) linear systems, using the indefinite inner product yᵀ x. The
+// preconditioner should also be complex symmetric. For real-valued systems this is
+// equivalent to CG.
+template <typename OperType>
+class CocgSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Temporary workspace for solve.
+  mutable VecType r, z, p, q;
+
+public:
+  CocgSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Preconditioned Conjugate A-Orthogonal Conjugate Residual (COCR) method for complex
+// symmetric linear systems. Compared to COCG, the residual norm typically decreases more
+// smoothly at the cost of one additional vector of storage. For real-valued systems this
+// is equivalent to the conjugate residual method.
+template <typename OperType>
+class CocrSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Temporary workspace for solve.
+  mutable VecType r, z, p, u, Az, Ap;
+
+public:
+  CocrSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Preconditioned Minimal Residual (MINRES) method for symmetric (Hermitian) indefinite
+// linear systems, with a symmetric (Hermitian) positive definite preconditioner.
+template <typename OperType>
+class MinresSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Temporary workspace for solve.
+  mutable VecType r1, r2, y, v, w1, w2;
+
+public:
+  MinresSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
+
+  void Mult(const VecType &b, VecType &x) const override;
 };
 
 // Base class defining enums for GMRES.
@@ -150,7 +270,9 @@ public:
   {
     MGS,
     CGS,
-    CGS2
+    CGS2,
+    CGS_FUSED,
+    CGS2_FUSED
   };
 
   enum class PrecSide
@@ -289,6 +411,153 @@ public:
   void Mult(const VecType &b, VecType &x) const override;
 };
 
+// Preconditioned Generalized Conjugate Residual method with inner Orthogonalization and
+// Deflated Restarting (GCRO-DR) for sequences of general nonsymmetric linear systems. A
+// subspace of harmonic Ritz vectors is recycled across restarts and across calls to Mult,
+// also when the operator is updated with SetOperator, which accelerates the solution of
+// slowly varying systems such as those arising in a frequency sweep. See Parks et al.,
+// Recycling Krylov subspaces for sequences of linear systems, SIAM J. Sci. Comput. (2006).
+template <typename OperType>
+class GcroDrSolver : public GmresSolver<OperType>
+{
+public:
+  using OrthogType = typename GmresSolverBase::OrthogType;
+  using PrecSide = typename GmresSolverBase::PrecSide;
+
+protected:
+  using VecType = typename GmresSolver<OperType>::VecType;
+  using RealType = typename GmresSolver<OperType>::RealType;
+  using ScalarType = typename GmresSolver<OperType>::ScalarType;
+
+  using GmresSolver<OperType>::comm;
+  using GmresSolver<OperType>::print_opts;
+  using GmresSolver<OperType>::int_width;
+  using GmresSolver<OperType>::tab_width;
+
+  using GmresSolver<OperType>::rel_tol;
+  using GmresSolver<OperType>::abs_tol;
+  using GmresSolver<OperType>::max_it;
+
+  using GmresSolver<OperType>::A;
+  using GmresSolver<OperType>::B;
+
+  using GmresSolver<OperType>::converged;
+  using GmresSolver<OperType>::initial_res;
+  using GmresSolver<OperType>::final_res;
+  using GmresSolver<OperType>::final_it;
+
+  using GmresSolver<OperType>::max_dim;
+  using GmresSolver<OperType>::orthog_type;
+  using GmresSolver<OperType>::pc_side;
+  using GmresSolver<OperType>::V;
+  using GmresSolver<OperType>::r;
+  using GmresSolver<OperType>::H;
+  using GmresSolver<OperType>::s;
+  using GmresSolver<OperType>::sn;
+  using GmresSolver<OperType>::cs;
+
+  // Maximum and current dimension of the recycled subspace.
+  int max_recycle_dim;
+  mutable int recycle_dim;
+
+  // Flag for recomputing the image of the recycled subspace after an operator update.
+  mutable bool update_recycle;
+
+  // Recycled subspace U with A B U = C, where C has orthonormal columns, and workspace.
+  mutable std::vector<VecType> U, C, T;
+  mutable VecType t;
+  mutable std::vector<ScalarType> Hbar, Bk;
+
+  // Allocate storage for solve.
+  void Initialize() const override;
+
+  // Restore A B U = C with orthonormal C for a new operator or preconditioner.
+  void UpdateRecycleOperator() const;
+
+  // Replace the recycled subspace with the harmonic Ritz vectors of smallest magnitude
+  // from the space spanned by the previous recycled subspace and the m Arnoldi vectors of
+  // the last cycle.
+  void UpdateRecycleSpace(int m) const;
+
+public:
+  GcroDrSolver(MPI_Comm comm, int print)
+    : GmresSolver<OperType>(comm, print), max_recycle_dim(0), recycle_dim(0),
+      update_recycle(false)
+  {
+    pc_side = PrecSide::RIGHT;
+  }
+
+  // Set the maximum dimension of the recycled subspace.
+  void SetRecycleDim(int dim) { max_recycle_dim = dim; }
+
+  void SetPrecSide(PrecSide side) override
+  {
+    MFEM_VERIFY(side == PrecSide::RIGHT,
+                "GCRO-DR solver only supports right preconditioning!");
+  }
+
+  void SetOperator(const OperType &op) override
+  {
+    GmresSolver<OperType>::SetOperator(op);
+    update_recycle = true;
+  }
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Preconditioned BiCGStab(ℓ) method for general nonsymmetric linear systems, which
+// combines ℓ steps of BiCG with an ℓ-th degree minimal residual polynomial update. Right
+// preconditioning is used so the true residual norm is monitored. The storage is 2ℓ + 5
+// vectors independent of the number of iterations, and ℓ = 1 is the standard BiCGStab
+// method.
+template <typename OperType>
+class BiCGStabSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Degree of the minimal residual polynomial.
+  int l;
+
+  // Temporary workspace for solve.
+  mutable std::vector<VecType> R, U;
+  mutable VecType r0, y, z;
+  mutable std::vector<ScalarType> tau, sigma, gamma, gamma1, gamma2;
+
+public:
+  BiCGStabSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print), l(2)
+  {
+  }
+
+  // Set the degree ℓ of the minimal residual polynomial.
+  void SetOrder(int order)
+  {
+    MFEM_VERIFY(order > 0, "BiCGStab(ℓ) solver requires ℓ > 0!");
+    l = order;
+  }
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
 }  // namespace palace
 
 #endif  // PALACE_LINALG_ITERATIVE_HPP
@@ -49,8 +49,30 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
         ksp = std::move(fgmres);
       }
       break;
+    case config::LinearSolverData::KspType::GCRODR:
+      {
+        auto gcrodr = std::make_unique<GcroDrSolver<OperType>>(comm, print);
+        gcrodr->SetRestartDim(iodata.solver.linear.max_size);
+        gcrodr->SetRecycleDim(iodata.solver.linear.recycle_size);
+        ksp = std::move(gcrodr);
+      }
+      break;
+    case config::LinearSolverData::KspType::COCG:
+      ksp = std::make_unique<CocgSolver<OperType>>(comm, print);
+      break;
+    case config::LinearSolverData::KspType::COCR:
+      ksp = std::make_unique<CocrSolver<OperType>>(comm, print);
+      break;
     case config::LinearSolverData::KspType::MINRES:
+      ksp = std::make_unique<MinresSolver<OperType>>(comm, print);
+      break;
     case config::LinearSolverData::KspType::BICGSTAB:
+      {
+        auto bicgstab = std::make_unique<BiCGStabSolver<OperType>>(comm, print);
+        bicgstab->SetOrder(iodata.solver.linear.bicgstab_order);
+        ksp = std::move(bicgstab);
+      }
+      break;
     case config::LinearSolverData::KspType::DEFAULT:
       MFEM_ABORT("Unexpected solver type for Krylov solver configuration!");
       break;
@@ -87,11 +109,12 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
     }
   }
 
-  // Configure orthogonalization method for GMRES/FMGRES.
+  // Configure orthogonalization method for GMRES/FMGRES/GCRO-DR.
   if (type == config::LinearSolverData::KspType::GMRES ||
-      type == config::LinearSolverData::KspType::FGMRES)
+      type == config::LinearSolverData::KspType::FGMRES ||
+      type == config::LinearSolverData::KspType::GCRODR)
   {
-    // Because FGMRES inherits from GMRES, this is OK.
+    // Because FGMRES and GCRO-DR inherit from GMRES, this is OK.
     auto *gmres = static_cast<GmresSolver<OperType> *>(ksp.get());
     switch (iodata.solver.linear.gs_orthog_type)
     {
@@ -104,6 +127,12 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
       case config::LinearSolverData::OrthogType::CGS2:
         gmres->SetOrthogonalization(GmresSolverBase::OrthogType::CGS2);
         break;
+      case config::LinearSolverData::OrthogType::CGS_FUSED:
+        gmres->SetOrthogonalization(GmresSolverBase::OrthogType::CGS_FUSED);
+        break;
+      case config::LinearSolverData::OrthogType::CGS2_FUSED:
+        gmres->SetOrthogonalization(GmresSolverBase::OrthogType::CGS2_FUSED);
+        break;
     }
   }
 
@@ -248,7 +277,8 @@ BaseKspSolver<OperType>::BaseKspSolver(const IoData &iodata,
 template <typename OperType>
 BaseKspSolver<OperType>::BaseKspSolver(std::unique_ptr<IterativeSolver<OperType>> &&ksp,
                                        std::unique_ptr<Solver<OperType>> &&pc)
-  : ksp(std::move(ksp)), pc(std::move(pc)), ksp_mult(0), ksp_mult_it(0), use_timer(false)
+  : ksp(std::move(ksp)), pc(std::move(pc)), ksp_mult(0), ksp_mult_it(0), pc_setup(0),
+    use_timer(false)
 {
   if (this->pc)
   {
@@ -273,9 +303,18 @@ void BaseKspSolver<OperType>::SetOperators(const OperType &op, const OperType &p
     {
       pc->SetOperator(pc_op);
     }
+    pc_setup++;
   }
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::SetOperator(const OperType &op)
+{
+  MFEM_VERIFY(!pc || pc_setup > 0,
+              "Preconditioner must be set up before reuse in BaseKspSolver::SetOperator!");
+  ksp->SetOperator(op);
+}
+
 template <typename OperType>
 void BaseKspSolver<OperType>::Mult(const VecType &x, VecType &y) const
 {
@@ -292,6 +331,35 @@ void BaseKspSolver<OperType>::Mult(const VecType &x, VecType &y) const
   ksp_mult_it += ksp->GetNumIterations();
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::Mult(const std::vector<VecType> &X,
+                                   std::vector<VecType> &Y) const
+{
+  MFEM_VERIFY(X.size() == Y.size(),
+              "Mismatch in number of right-hand sides and solution vectors for KSP solve!");
+  const auto *cg = dynamic_cast<const CgSolver<OperType> *>(ksp.get());
+  if (cg && X.size() > 1)
+  {
+    // Solve all systems at once with block CG.
+    BlockTimer bt(Timer::KSP, use_timer);
+    cg->Mult(X, Y);
+    if (!ksp->GetConverged())
+    {
+      Mpi::Warning(ksp->GetComm(),
+                   "Linear solver did not converge for all right-hand sides, "
+                   "norm(AX-B)/norm(B) = {:.3e} (norm(B) = {:.3e})!\n",
+                   ksp->GetFinalRes() / ksp->GetInitialRes(), ksp->GetInitialRes());
+    }
+    ksp_mult += static_cast<int>(X.size());
+    ksp_mult_it += static_cast<int>(X.size()) * ksp->GetNumIterations();
+    return;
+  }
+  for (std::size_t j = 0; j < X.size(); j++)
+  {
+    Mult(X[j], Y[j]);
+  }
+}
+
 template class BaseKspSolver<Operator>;
 template class BaseKspSolver<ComplexOperator>;
 
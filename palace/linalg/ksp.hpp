@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <vector>
 #include "linalg/iterative.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/solver.hpp"
@@ -39,6 +40,9 @@ protected:
   // of iterations.
   mutable int ksp_mult, ksp_mult_it;
 
+  // Counter for number of preconditioner setups.
+  int pc_setup;
+
   // Enable timer contribution for Timer::KSP_PRECONDITIONER.
   bool use_timer;
 
@@ -50,10 +54,20 @@ public:
 
   int NumTotalMult() const { return ksp_mult; }
   int NumTotalMultIterations() const { return ksp_mult_it; }
+  int NumTotalPreconditionerSetup() const { return pc_setup; }
 
   void SetOperators(const OperType &op, const OperType &pc_op);
 
+  // Update the system operator while reusing the preconditioner from the previous call to
+  // SetOperators. The preconditioner operator must remain valid.
+  void SetOperator(const OperType &op);
+
   void Mult(const VecType &x, VecType &y) const;
+
+  // Solve for multiple right-hand sides which share the same operator and preconditioner.
+  // Each column uses the corresponding entry of Y as its initial guess when enabled. With
+  // CG, the systems are solved together using block CG.
+  void Mult(const std::vector<VecType> &X, std::vector<VecType> &Y) const;
 };
 
 using KspSolver = BaseKspSolver<Operator>;
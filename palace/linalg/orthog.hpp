@@ -12,8 +12,8 @@ namespace palace::linalg
 {
 
 //
-// Orthogonalization functions for orthogonalizing a vector against a number of basis
-// vectors using modified or classical Gram-Schmidt.
+// Orthogonalization functions for orthogonalizing a vector (or block of vectors) against
+// a number of basis vectors using modified or classical Gram-Schmidt.
 //
 
 template <typename VecType, typename ScalarType>
@@ -39,10 +39,7 @@ inline void OrthogonalizeColumnCGS(MPI_Comm comm, const std::vector<VecType> &V,
   {
     return;
   }
-  for (int j = 0; j < m; j++)
-  {
-    H[j] = w * V[j];  // Local inner product
-  }
+  linalg::LocalDots(w, V, H, m);
   Mpi::GlobalSum(m, H, comm);
   for (int j = 0; j < m; j++)
   {
@@ -51,10 +48,7 @@ inline void OrthogonalizeColumnCGS(MPI_Comm comm, const std::vector<VecType> &V,
   if (refine)
   {
     std::vector<ScalarType> dH(m);
-    for (int j = 0; j < m; j++)
-    {
-      dH[j] = w * V[j];  // Local inner product
-    }
+    linalg::LocalDots(w, V, dH.data(), m);
     Mpi::GlobalSum(m, dH.data(), comm);
     for (int j = 0; j < m; j++)
     {
@@ -64,6 +58,76 @@ inline void OrthogonalizeColumnCGS(MPI_Comm comm, const std::vector<VecType> &V,
   }
 }
 
+template <typename VecType, typename ScalarType>
+inline double OrthogonalizeColumnCGSFused(MPI_Comm comm, const std::vector<VecType> &V,
+                                          VecType &w, ScalarType *H, int m,
+                                          bool refine = false)
+{
+  // Variant of CGS (or CGS2) which fuses the computation of the norm of the orthogonalized
+  // vector into the global reduction for the inner products of the final pass, using
+  // ||w - V h||² = ||w||² - ||h||² for orthonormal V. This requires one (CGS) or two (CGS2)
+  // global reductions in total including normalization, rather than two or three. Returns
+  // the norm of the orthogonalized vector.
+  MFEM_ASSERT(static_cast<std::size_t>(m) <= V.size(),
+              "Out of bounds number of columns for CGS orthogonalization!");
+  if (refine)
+  {
+    OrthogonalizeColumnCGS(comm, V, w, H, m);
+  }
+  std::vector<ScalarType> dots(m + 1);
+  linalg::LocalDots(w, V, dots.data(), m);
+  dots[m] = w * w;
+  Mpi::GlobalSum(m + 1, dots.data(), comm);
+  double normh2 = 0.0;
+  for (int j = 0; j < m; j++)
+  {
+    H[j] = refine ? H[j] + dots[j] : dots[j];
+    normh2 += std::norm(dots[j]);
+    w.Add(-dots[j], V[j]);
+  }
+
+  // The identity loses accuracy when w lies nearly in the span of V, in which case the norm
+  // is computed explicitly.
+  constexpr double cancel_tol = 1.0e-6;
+  const double normw2 = std::real(dots[m]);
+  return (normw2 - normh2 > cancel_tol * normw2) ? std::sqrt(normw2 - normh2)
+                                                 : linalg::Norml2(comm, w);
+}
+
+template <typename VecType, typename ScalarType>
+inline void OrthogonalizeBlockCGS(MPI_Comm comm, const std::vector<VecType> &V,
+                                  std::vector<VecType> &W, ScalarType *H, int m,
+                                  bool refine = false)
+{
+  // Orthogonalize each column of W against the leading m columns of V. H is stored as an
+  // m x k column-major matrix, where k is the number of columns of W. Each pass requires a
+  // single global reduction for the entire block.
+  MFEM_ASSERT(static_cast<std::size_t>(m) <= V.size(),
+              "Out of bounds number of columns for block CGS orthogonalization!");
+  const int k = static_cast<int>(W.size());
+  if (m == 0 || k == 0)
+  {
+    return;
+  }
+  std::vector<ScalarType> dH(m * k);
+  for (int pass = 0; pass < 1 + refine; pass++)
+  {
+    for (int l = 0; l < k; l++)
+    {
+      linalg::LocalDots(W[l], V, dH.data() + l * m, m);
+    }
+    Mpi::GlobalSum(m * k, dH.data(), comm);
+    for (int l = 0; l < k; l++)
+    {
+      for (int j = 0; j < m; j++)
+      {
+        H[l * m + j] = (pass == 0) ? dH[l * m + j] : H[l * m + j] + dH[l * m + j];
+        W[l].Add(-dH[l * m + j], V[j]);
+      }
+    }
+  }
+}
+
 }  // namespace palace::linalg
 
 #endif  // PALACE_LINALG_ORTHOG_HPP
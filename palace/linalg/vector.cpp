@@ -3,6 +3,7 @@
 
 #include "vector.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <random>
 #include <mfem/general/forall.hpp>
@@ -649,6 +650,112 @@ std::complex<double> LocalDot(const ComplexVector &x, const ComplexVector &y)
   }
 }
 
+namespace
+{
+
+// Block size for fused multi-vector inner products, chosen such that a block of x remains
+// in cache while it is multiplied against all of the vectors in V.
+constexpr int DOTS_BLOCK_SIZE = 2048;
+
+inline bool UseDeviceDots(const Vector &x)
+{
+  return x.UseDevice() && mfem::Device::Allows(mfem::Backend::DEVICE_MASK);
+}
+
+}  // namespace
+
+void LocalDots(const Vector &x, const std::vector<Vector> &V, double *dots, int n)
+{
+  MFEM_ASSERT(static_cast<std::size_t>(n) <= V.size(),
+              "Out of bounds number of vectors for fused inner products!");
+  if (UseDeviceDots(x))
+  {
+    for (int j = 0; j < n; j++)
+    {
+      dots[j] = LocalDot(x, V[j]);
+    }
+    return;
+  }
+  const int N = x.Size();
+  const auto *X = x.HostRead();
+  std::vector<const double *> VV(n);
+  for (int j = 0; j < n; j++)
+  {
+    MFEM_ASSERT(V[j].Size() == N, "Size mismatch for vector inner product!");
+    VV[j] = V[j].HostRead();
+    dots[j] = 0.0;
+  }
+  const int nb = (N + DOTS_BLOCK_SIZE - 1) / DOTS_BLOCK_SIZE;
+  PalacePragmaOmp(parallel for schedule(static) reduction(+ : dots[:n]) if (nb > 1))
+  for (int b = 0; b < nb; b++)
+  {
+    const int i0 = b * DOTS_BLOCK_SIZE, i1 = std::min(i0 + DOTS_BLOCK_SIZE, N);
+    for (int j = 0; j < n; j++)
+    {
+      const auto *Vj = VV[j];
+      double sum = 0.0;
+      for (int i = i0; i < i1; i++)
+      {
+        sum += X[i] * Vj[i];
+      }
+      dots[j] += sum;
+    }
+  }
+}
+
+void LocalDots(const ComplexVector &x, const std::vector<ComplexVector> &V,
+               std::complex<double> *dots, int n)
+{
+  MFEM_ASSERT(static_cast<std::size_t>(n) <= V.size(),
+              "Out of bounds number of vectors for fused inner products!");
+  if (UseDeviceDots(x.Real()))
+  {
+    for (int j = 0; j < n; j++)
+    {
+      dots[j] = LocalDot(x, V[j]);
+    }
+    return;
+  }
+  const int N = x.Size();
+  const auto *XR = x.Real().HostRead();
+  const auto *XI = x.Imag().HostRead();
+  std::vector<const double *> VR(n), VI(n);
+  for (int j = 0; j < n; j++)
+  {
+    MFEM_ASSERT(V[j].Size() == N, "Size mismatch for vector inner product!");
+    VR[j] = V[j].Real().HostRead();
+    VI[j] = V[j].Imag().HostRead();
+  }
+
+  // OpenMP does not provide a reduction for std::complex, so the real and imaginary parts
+  // are reduced separately.
+  std::vector<double> dotsr(n, 0.0), dotsi(n, 0.0);
+  auto *DR = dotsr.data();
+  auto *DI = dotsi.data();
+  const int nb = (N + DOTS_BLOCK_SIZE - 1) / DOTS_BLOCK_SIZE;
+  PalacePragmaOmp(parallel for schedule(static) reduction(+ : DR[:n], DI[:n]) if (nb > 1))
+  for (int b = 0; b < nb; b++)
+  {
+    const int i0 = b * DOTS_BLOCK_SIZE, i1 = std::min(i0 + DOTS_BLOCK_SIZE, N);
+    for (int j = 0; j < n; j++)
+    {
+      const auto *VRj = VR[j], *VIj = VI[j];
+      double sumr = 0.0, sumi = 0.0;
+      for (int i = i0; i < i1; i++)
+      {
+        sumr += XR[i] * VRj[i] + XI[i] * VIj[i];
+        sumi += XI[i] * VRj[i] - XR[i] * VIj[i];
+      }
+      DR[j] += sumr;
+      DI[j] += sumi;
+    }
+  }
+  for (int j = 0; j < n; j++)
+  {
+    dots[j] = {DR[j], DI[j]};
+  }
+}
+
 double LocalSum(const Vector &x)
 {
   static hypre::HypreVector X;
@@ -183,6 +183,12 @@ void SetRandomSign(MPI_Comm comm, VecType &x, int seed = 0);
 double LocalDot(const Vector &x, const Vector &y);
 std::complex<double> LocalDot(const ComplexVector &x, const ComplexVector &y);
 
+// Calculate the local inner products of x with each of the leading n vectors of V, dots[j]
+// = LocalDot(x, V[j]), in a single pass over the vector data.
+void LocalDots(const Vector &x, const std::vector<Vector> &V, double *dots, int n);
+void LocalDots(const ComplexVector &x, const std::vector<ComplexVector> &V,
+               std::complex<double> *dots, int n);
+
 // Calculate the parallel inner product yᴴ x or yᵀ x.
 template <typename VecType>
 inline auto Dot(MPI_Comm comm, const VecType &x, const VecType &y)
@@ -21,6 +21,7 @@
 #include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
 #include "utils/omp.hpp"
+#include "utils/profiler.hpp"
 #include "utils/timer.hpp"
 
 #if defined(MFEM_USE_STRUMPACK)
@@ -258,6 +259,7 @@ int main(int argc, char *argv[])
   // Parse configuration file.
   PrintPalaceBanner(world_comm);
   IoData iodata(argv[1], false);
+  Profiler::SetTrace(iodata.problem.trace);
 
   // Initialize the MFEM device and configure libCEED backend.
   int omp_threads = ConfigureOmp(), ngpu = GetDeviceCount();
@@ -15,6 +15,40 @@
 namespace palace
 {
 
+namespace
+{
+
+void GetFieldEnergyMatrix(const Operator &M, const mfem::ParFiniteElementSpace &fespace,
+                          const std::vector<Vector> &X, Vector &y, mfem::DenseMatrix &W)
+{
+  // W_ij = (P x_i)ᵀ M (P x_j) = x_iᵀ Pᵀ M P x_j, where the local contributions to the upper
+  // triangle are computed as each column is formed and then reduced together.
+  const auto *P = fespace.GetProlongationMatrix();
+  const int n = static_cast<int>(X.size());
+  Vector xl(M.Width()), yt(fespace.GetTrueVSize());
+  xl.UseDevice(true);
+  yt.UseDevice(true);
+  std::vector<double> dots(n * (n + 1) / 2);
+  for (int j = 0; j < n; j++)
+  {
+    P->Mult(X[j], xl);
+    M.Mult(xl, y);
+    P->MultTranspose(y, yt);
+    linalg::LocalDots(yt, X, dots.data() + j * (j + 1) / 2, j + 1);
+  }
+  Mpi::GlobalSum(static_cast<int>(dots.size()), dots.data(), fespace.GetComm());
+  W.SetSize(n);
+  for (int j = 0; j < n; j++)
+  {
+    for (int i = 0; i <= j; i++)
+    {
+      W(i, j) = W(j, i) = dots[j * (j + 1) / 2 + i];
+    }
+  }
+}
+
+}  // namespace
+
 DomainPostOperator::DomainPostOperator(const IoData &iodata, const MaterialOperator &mat_op,
                                        const FiniteElementSpace &nd_fespace,
                                        const FiniteElementSpace &rt_fespace)
@@ -139,86 +173,89 @@ DomainPostOperator::DomainPostOperator(const IoData &iodata, const MaterialOpera
   }
 }
 
-double DomainPostOperator::GetElectricFieldEnergy(const GridFunction &E) const
+void DomainPostOperator::GetElectricFieldEnergyMatrix(
+    const std::vector<Vector> &X, const mfem::ParFiniteElementSpace &fespace,
+    mfem::DenseMatrix &W) const
 {
   if (M_elec)
   {
-    M_elec->Mult(E.Real(), D);
-    double dot = linalg::LocalDot(E.Real(), D);
-    if (E.HasImag())
-    {
-      M_elec->Mult(E.Imag(), D);
-      dot += linalg::LocalDot(E.Imag(), D);
-    }
-    Mpi::GlobalSum(1, &dot, E.GetComm());
-    return 0.5 * dot;
+    GetFieldEnergyMatrix(*M_elec, fespace, X, D, W);
+    return;
   }
   MFEM_ABORT(
       "Domain postprocessing is not configured for electric field energy calculation!");
-  return 0.0;
 }
 
-double DomainPostOperator::GetMagneticFieldEnergy(const GridFunction &B) const
+void DomainPostOperator::GetMagneticFieldEnergyMatrix(
+    const std::vector<Vector> &X, const mfem::ParFiniteElementSpace &fespace,
+    mfem::DenseMatrix &W) const
 {
   if (M_mag)
   {
-    M_mag->Mult(B.Real(), H);
-    double dot = linalg::LocalDot(B.Real(), H);
-    if (B.HasImag())
-    {
-      M_mag->Mult(B.Imag(), H);
-      dot += linalg::LocalDot(B.Imag(), H);
-    }
-    Mpi::GlobalSum(1, &dot, B.GetComm());
-    return 0.5 * dot;
+    GetFieldEnergyMatrix(*M_mag, fespace, X, H, W);
+    return;
   }
   MFEM_ABORT(
       "Domain postprocessing is not configured for magnetic field energy calculation!");
-  return 0.0;
 }
 
-double DomainPostOperator::GetDomainElectricFieldEnergy(int idx,
-                                                        const GridFunction &E) const
+void DomainPostOperator::GetFieldEnergies(
+    const GridFunction *E, const GridFunction *B, double &E_elec, double &E_mag,
+    std::map<int, std::pair<double, double>> &E_domains) const
 {
-  // Compute the electric field energy integral for only a portion of the domain.
-  auto it = M_i.find(idx);
-  MFEM_VERIFY(it != M_i.end(),
-              "Invalid domain index when postprocessing domain electric field energy!");
-  if (!it->second.first)
+  // Local contributions are stored as [E_elec, E_mag, E_elec[0], E_mag[0], ...] for all
+  // domains and reduced together.
+  MFEM_VERIFY(E || B, "Missing field for domain energy postprocessing!");
+  MFEM_VERIFY(!E || M_elec,
+              "Domain postprocessing is not configured for electric field energy "
+              "calculation!");
+  MFEM_VERIFY(!B || M_mag,
+              "Domain postprocessing is not configured for magnetic field energy "
+              "calculation!");
+  std::vector<double> dots(2 * (M_i.size() + 1), 0.0);
+  auto AddLocalEnergies = [this, &dots](const GridFunction &U, const Operator &M, Vector &Y,
+                                        int offset)
   {
-    return 0.0;
-  }
-  it->second.first->Mult(E.Real(), D);
-  double dot = linalg::LocalDot(E.Real(), D);
-  if (E.HasImag())
+    std::vector<const Operator *> ops = {&M};
+    for (const auto &[idx, M_idx] : M_i)
+    {
+      ops.push_back((offset == 0) ? M_idx.first.get() : M_idx.second.get());
+    }
+    for (std::size_t k = 0; k < ops.size(); k++)
+    {
+      if (!ops[k])
+      {
+        continue;
+      }
+      ops[k]->Mult(U.Real(), Y);
+      dots[2 * k + offset] = linalg::LocalDot(U.Real(), Y);
+      if (U.HasImag())
+      {
+        ops[k]->Mult(U.Imag(), Y);
+        dots[2 * k + offset] += linalg::LocalDot(U.Imag(), Y);
+      }
+    }
+  };
+  if (E)
   {
-    it->second.first->Mult(E.Imag(), D);
-    dot += linalg::LocalDot(E.Imag(), D);
+    AddLocalEnergies(*E, *M_elec, D, 0);
   }
-  Mpi::GlobalSum(1, &dot, E.GetComm());
-  return 0.5 * dot;
-}
-
-double DomainPostOperator::GetDomainMagneticFieldEnergy(int idx,
-                                                        const GridFunction &B) const
-{
-  // Compute the magnetic field energy integral for only a portion of the domain.
-  auto it = M_i.find(idx);
-  MFEM_VERIFY(it != M_i.end(),
-              "Invalid domain index when postprocessing domain magnetic field energy!");
-  if (!it->second.second)
+  if (B)
   {
-    return 0.0;
+    AddLocalEnergies(*B, *M_mag, H, 1);
   }
-  it->second.second->Mult(B.Real(), H);
-  double dot = linalg::LocalDot(B.Real(), H);
-  if (B.HasImag())
+  Mpi::GlobalSum(static_cast<int>(dots.size()), dots.data(),
+                 E ? E->GetComm() : B->GetComm());
+
+  E_elec = 0.5 * dots[0];
+  E_mag = 0.5 * dots[1];
+  E_domains.clear();
+  std::size_t k = 1;
+  for (const auto &[idx, M_idx] : M_i)
   {
-    it->second.second->Mult(B.Imag(), H);
-    dot += linalg::LocalDot(B.Imag(), H);
+    E_domains.emplace(idx, std::make_pair(0.5 * dots[2 * k], 0.5 * dots[2 * k + 1]));
+    k++;
   }
-  Mpi::GlobalSum(1, &dot, B.GetComm());
-  return 0.5 * dot;
 }
 
 }  // namespace palace
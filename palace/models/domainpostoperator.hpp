@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 #include "linalg/operator.hpp"
 #include "linalg/vector.hpp"
 
@@ -44,15 +45,25 @@ public:
   // Access data structures for postprocessing domains.
   const auto &GetDomains() const { return M_i; }
 
-  // Get volume integrals computing the electric or magnetic field energy in the entire
-  // domain.
-  double GetElectricFieldEnergy(const GridFunction &E) const;
-  double GetMagneticFieldEnergy(const GridFunction &B) const;
+  // Get the matrix of mutual electric or magnetic field energies for a set of real-valued
+  // fields given on the true dofs of the finite element space, W_ij = (x_i, M x_j), such
+  // that the field energy for x_i is 1/2 W_ii. This requires one operator application per
+  // field and a single global reduction.
+  void GetElectricFieldEnergyMatrix(const std::vector<Vector> &X,
+                                    const mfem::ParFiniteElementSpace &fespace,
+                                    mfem::DenseMatrix &W) const;
+  void GetMagneticFieldEnergyMatrix(const std::vector<Vector> &X,
+                                    const mfem::ParFiniteElementSpace &fespace,
+                                    mfem::DenseMatrix &W) const;
 
-  // Get volume integrals for the electric or magnetic field energy in a portion of the
-  // domain.
-  double GetDomainElectricFieldEnergy(int idx, const GridFunction &E) const;
-  double GetDomainMagneticFieldEnergy(int idx, const GridFunction &E) const;
+  // Get volume integrals for the electric and magnetic field energy in the entire domain
+  // and in each of the postprocessing domains (indexed as in GetDomains). Each energy
+  // requires one operator application for each of the real and imaginary parts of the
+  // field, but all of the energies are computed with a single global reduction. Either field
+  // may be nullptr, in which case the corresponding energies are zero.
+  void GetFieldEnergies(const GridFunction *E, const GridFunction *B, double &E_elec,
+                        double &E_mag,
+                        std::map<int, std::pair<double, double>> &E_domains) const;
 };
 
 }  // namespace palace
@@ -303,6 +303,21 @@ std::complex<double> LumpedPortData::GetVoltage(GridFunction &E) const
   return dot;
 }
 
+void LumpedPortData::GetTrueDofLinearForms(mfem::ParFiniteElementSpace &nd_fespace,
+                                           mfem::Vector &s_t, mfem::Vector &v_t) const
+{
+  // The grid function is E = P e, so the functionals on the true dofs are given by the
+  // transpose of the prolongation applied to the linear forms.
+  InitializeLinearForms(nd_fespace);
+  const auto *P = nd_fespace.GetProlongationMatrix();
+  s_t.SetSize(nd_fespace.GetTrueVSize());
+  v_t.SetSize(nd_fespace.GetTrueVSize());
+  s_t.UseDevice(true);
+  v_t.UseDevice(true);
+  P->MultTranspose(*s, s_t);
+  P->MultTranspose(*v, v_t);
+}
+
 LumpedPortOperator::LumpedPortOperator(const IoData &iodata, const MaterialOperator &mat_op,
                                        mfem::ParFiniteElementSpace &h1_fespace)
 {
@@ -646,15 +661,29 @@ void LumpedPortOperator::AddExcitationBdrCoefficients(SumVectorCoefficient &fb)
     {
       continue;
     }
-    MFEM_VERIFY(std::abs(data.R) > 0.0,
-                "Unexpected zero resistance in excited lumped port!");
-    for (const auto &elem : data.elems)
-    {
-      const double Rs = data.R * data.GetToSquare(*elem);
-      const double Hinc = 1.0 / std::sqrt(Rs * elem->GetGeometryWidth() *
-                                          elem->GetGeometryLength() * data.elems.size());
-      fb.AddCoefficient(elem->GetModeCoefficient(2.0 * Hinc));
-    }
+    AddExcitationBdrCoefficients(data, fb);
+  }
+}
+
+void LumpedPortOperator::AddExcitationBdrCoefficients(int idx, SumVectorCoefficient &fb)
+{
+  // Construct the RHS source term for a single excited lumped port index.
+  const LumpedPortData &data = GetPort(idx);
+  MFEM_VERIFY(data.excitation,
+              "Lumped port index " << idx << " is not marked for excitation!");
+  AddExcitationBdrCoefficients(data, fb);
+}
+
+void LumpedPortOperator::AddExcitationBdrCoefficients(const LumpedPortData &data,
+                                                      SumVectorCoefficient &fb)
+{
+  MFEM_VERIFY(std::abs(data.R) > 0.0, "Unexpected zero resistance in excited lumped port!");
+  for (const auto &elem : data.elems)
+  {
+    const double Rs = data.R * data.GetToSquare(*elem);
+    const double Hinc = 1.0 / std::sqrt(Rs * elem->GetGeometryWidth() *
+                                        elem->GetGeometryLength() * data.elems.size());
+    fb.AddCoefficient(elem->GetModeCoefficient(2.0 * Hinc));
   }
 }
 
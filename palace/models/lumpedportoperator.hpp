@@ -75,6 +75,12 @@ public:
   std::complex<double> GetPower(GridFunction &E, GridFunction &B) const;
   std::complex<double> GetSParameter(GridFunction &E) const;
   std::complex<double> GetVoltage(GridFunction &E) const;
+
+  // Return the linear functionals on the true dofs of the given space for the port
+  // S-parameter and voltage, such that S = sᵀ e and V = vᵀ e (after a global sum) for the
+  // solution vector e.
+  void GetTrueDofLinearForms(mfem::ParFiniteElementSpace &nd_fespace, mfem::Vector &s_t,
+                             mfem::Vector &v_t) const;
 };
 
 //
@@ -120,6 +126,8 @@ public:
   // excited port boundaries, -U_inc/(iω) for the real version (versus the full -U_inc for
   // the complex one).
   void AddExcitationBdrCoefficients(SumVectorCoefficient &fb);
+  void AddExcitationBdrCoefficients(int idx, SumVectorCoefficient &fb);
+  void AddExcitationBdrCoefficients(const LumpedPortData &data, SumVectorCoefficient &fb);
 };
 
 }  // namespace palace
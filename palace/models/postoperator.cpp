@@ -3,6 +3,9 @@
 
 #include "postoperator.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include "fem/coefficient.hpp"
 #include "fem/errorindicator.hpp"
 #include "models/curlcurloperator.hpp"
@@ -34,6 +37,24 @@ auto CreateParaviewPath(const IoData &iodata, const std::string &name)
   return path;
 }
 
+std::array<std::complex<double>, 3> GetLumpedPortCurrents(const LumpedPortData &data,
+                                                          std::complex<double> V,
+                                                          double omega)
+{
+  // Compute current from the port impedance, separate contributions for R, L, C branches.
+  MFEM_VERIFY(omega > 0.0,
+              "Frequency domain lumped port postprocessing requires nonzero frequency!");
+  return {(std::abs(data.R) > 0.0)
+              ? V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::R)
+              : 0.0,
+          (std::abs(data.L) > 0.0)
+              ? V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::L)
+              : 0.0,
+          (std::abs(data.C) > 0.0)
+              ? V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::C)
+              : 0.0};
+}
+
 }  // namespace
 
 PostOperator::PostOperator(const IoData &iodata, SpaceOperator &spaceop,
@@ -47,34 +68,11 @@ PostOperator::PostOperator(const IoData &iodata, SpaceOperator &spaceop,
     B(std::in_place, spaceop.GetRTSpace(),
       iodata.problem.type != config::ProblemData::Type::TRANSIENT),
     V(std::nullopt), A(std::nullopt), lumped_port_init(false), wave_port_init(false),
-    paraview(CreateParaviewPath(iodata, name), &spaceop.GetNDSpace().GetParMesh()),
-    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
-                 &spaceop.GetNDSpace().GetParMesh()),
+    domain_E_init(false),
+    paraview(CreateParaviewPath(iodata, name)),
+    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary"),
     interp_op(iodata, spaceop.GetNDSpace().GetParMesh())
 {
-  Esr = std::make_unique<BdrFieldVectorCoefficient>(E->Real(), mat_op);
-  Bsr = std::make_unique<BdrFieldVectorCoefficient>(B->Real(), mat_op);
-  Jsr = std::make_unique<BdrCurrentVectorCoefficient>(B->Real(), mat_op);
-  Qsr = std::make_unique<BdrChargeCoefficient>(E->Real(), mat_op);
-  if (HasImag())
-  {
-    Esi = std::make_unique<BdrFieldVectorCoefficient>(E->Imag(), mat_op);
-    Bsi = std::make_unique<BdrFieldVectorCoefficient>(B->Imag(), mat_op);
-    Jsi = std::make_unique<BdrCurrentVectorCoefficient>(B->Imag(), mat_op);
-    Qsi = std::make_unique<BdrChargeCoefficient>(E->Imag(), mat_op);
-    Ue =
-        std::make_unique<EnergyDensityCoefficient<EnergyDensityType::ELECTRIC>>(*E, mat_op);
-    Um =
-        std::make_unique<EnergyDensityCoefficient<EnergyDensityType::MAGNETIC>>(*B, mat_op);
-  }
-  else
-  {
-    Ue =
-        std::make_unique<EnergyDensityCoefficient<EnergyDensityType::ELECTRIC>>(*E, mat_op);
-    Um =
-        std::make_unique<EnergyDensityCoefficient<EnergyDensityType::MAGNETIC>>(*B, mat_op);
-  }
-
   // Add wave port boundary mode postprocessing when available.
   for (const auto &[idx, data] : spaceop.GetWavePortOp())
   {
@@ -94,18 +92,14 @@ PostOperator::PostOperator(const IoData &iodata, LaplaceOperator &laplaceop,
     dom_post_op(iodata, laplaceop.GetMaterialOp(), laplaceop.GetH1Space()),
     E(std::in_place, laplaceop.GetNDSpace()), B(std::nullopt), V(laplaceop.GetH1Space()),
     A(std::nullopt), lumped_port_init(false), wave_port_init(false),
-    paraview(CreateParaviewPath(iodata, name), &laplaceop.GetNDSpace().GetParMesh()),
-    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
-                 &laplaceop.GetNDSpace().GetParMesh()),
+    domain_E_init(false),
+    paraview(CreateParaviewPath(iodata, name)),
+    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary"),
     interp_op(iodata, laplaceop.GetNDSpace().GetParMesh())
 {
   // Note: When using this constructor, you should not use any of the magnetic field related
   // postprocessing functions (magnetic field energy, inductor energy, surface currents,
   // etc.), since only V and E fields are supplied.
-  Esr = std::make_unique<BdrFieldVectorCoefficient>(E->Real(), mat_op);
-  Vs = std::make_unique<BdrFieldCoefficient>(V->Real(), mat_op);
-  Ue = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::ELECTRIC>>(*E, mat_op);
-  Qsr = std::make_unique<BdrChargeCoefficient>(E->Real(), mat_op);
 
   // Initialize data collection objects.
   InitializeDataCollection(iodata);
@@ -118,18 +112,14 @@ PostOperator::PostOperator(const IoData &iodata, CurlCurlOperator &curlcurlop,
     dom_post_op(iodata, curlcurlop.GetMaterialOp(), curlcurlop.GetNDSpace()),
     E(std::nullopt), B(std::in_place, curlcurlop.GetRTSpace()), V(std::nullopt),
     A(curlcurlop.GetNDSpace()), lumped_port_init(false), wave_port_init(false),
-    paraview(CreateParaviewPath(iodata, name), &curlcurlop.GetNDSpace().GetParMesh()),
-    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
-                 &curlcurlop.GetNDSpace().GetParMesh()),
+    domain_E_init(false),
+    paraview(CreateParaviewPath(iodata, name)),
+    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary"),
     interp_op(iodata, curlcurlop.GetNDSpace().GetParMesh())
 {
   // Note: When using this constructor, you should not use any of the electric field related
   // postprocessing functions (electric field energy, capacitor energy, surface charge,
   // etc.), since only the B field is supplied.
-  Bsr = std::make_unique<BdrFieldVectorCoefficient>(B->Real(), mat_op);
-  As = std::make_unique<BdrFieldVectorCoefficient>(A->Real(), mat_op);
-  Um = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::MAGNETIC>>(*B, mat_op);
-  Jsr = std::make_unique<BdrCurrentVectorCoefficient>(B->Real(), mat_op);
 
   // Initialize data collection objects.
   InitializeDataCollection(iodata);
@@ -163,6 +153,107 @@ void PostOperator::InitializeDataCollection(const IoData &iodata)
   paraview_bdr.SetCompressionLevel(compress);
   paraview_bdr.SetHighOrderOutput(use_ho);
   paraview_bdr.SetLevelsOfDetail(refine_ho);
+}
+
+struct PostOperator::OutputData
+{
+  // Dimensionalized copy of the mesh and finite element spaces for the field copies.
+  std::unique_ptr<mfem::ParMesh> mesh;
+  std::vector<std::unique_ptr<mfem::ParFiniteElementSpace>> fespaces;
+  std::optional<GridFunction> E, B, V, A;
+
+  // Coefficients for boundary and energy density field output.
+  std::unique_ptr<mfem::VectorCoefficient> Esr, Esi, Bsr, Bsi, As, Jsr, Jsi;
+  std::unique_ptr<mfem::Coefficient> Vs, Ue, Um, Qsr, Qsi;
+
+  // Piecewise constant fields for the process rank and error indicator. No need for these
+  // to be parallel objects, since the data is local to each process and there isn't a need
+  // to ever access the element neighbors.
+  std::unique_ptr<mfem::L2_FECollection> pwconst_fec;
+  std::unique_ptr<mfem::FiniteElementSpace> pwconst_fespace;
+  std::unique_ptr<mfem::GridFunction> rank, eta;
+};
+
+PostOperator::~PostOperator()
+{
+  WaitFields();
+}
+
+void PostOperator::InitializeOutputData() const
+{
+  // Construct a copy of the mesh with coordinates in the same units as originally input,
+  // once, rather than redimensionalizing the mesh in place for every write. The field
+  // copies live on this mesh so that the solution grid functions can be updated while a
+  // previous write is still in progress.
+  const mfem::ParMesh &mesh =
+      HasE() ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
+  output = std::make_unique<OutputData>();
+  auto &out = *output;
+  out.mesh = std::make_unique<mfem::ParMesh>(mesh);
+  out.mesh->ExchangeFaceNbrData();
+  mesh::DimensionalizeMesh(*out.mesh, mesh_Lc0);
+  auto InitializeGridFunction = [&out](const std::optional<GridFunction> &U,
+                                       std::optional<GridFunction> &U_out)
+  {
+    if (!U)
+    {
+      return;
+    }
+    auto &fespace = out.fespaces.emplace_back(std::make_unique<mfem::ParFiniteElementSpace>(
+        out.mesh.get(), U->ParFESpace()->FEColl()));
+    U_out.emplace(*fespace, U->HasImag());
+    U_out->Real().ExchangeFaceNbrData();
+    if (U_out->HasImag())
+    {
+      U_out->Imag().ExchangeFaceNbrData();
+    }
+  };
+  InitializeGridFunction(E, out.E);
+  InitializeGridFunction(B, out.B);
+  InitializeGridFunction(V, out.V);
+  InitializeGridFunction(A, out.A);
+  out.pwconst_fec = std::make_unique<mfem::L2_FECollection>(0, out.mesh->Dimension());
+  out.pwconst_fespace =
+      std::make_unique<mfem::FiniteElementSpace>(out.mesh.get(), out.pwconst_fec.get());
+  out.rank = std::make_unique<mfem::GridFunction>(out.pwconst_fespace.get());
+  *out.rank = out.mesh->GetMyRank() + 1;
+  out.eta = std::make_unique<mfem::GridFunction>(out.pwconst_fespace.get());
+
+  // Extract boundary and energy density fields from the E-field, B-field, and potentials.
+  if (out.E)
+  {
+    out.Esr = std::make_unique<BdrFieldVectorCoefficient>(out.E->Real(), mat_op);
+    out.Qsr = std::make_unique<BdrChargeCoefficient>(out.E->Real(), mat_op);
+    if (HasImag())
+    {
+      out.Esi = std::make_unique<BdrFieldVectorCoefficient>(out.E->Imag(), mat_op);
+      out.Qsi = std::make_unique<BdrChargeCoefficient>(out.E->Imag(), mat_op);
+    }
+    out.Ue = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::ELECTRIC>>(
+        *out.E, mat_op);
+  }
+  if (out.B)
+  {
+    out.Bsr = std::make_unique<BdrFieldVectorCoefficient>(out.B->Real(), mat_op);
+    out.Jsr = std::make_unique<BdrCurrentVectorCoefficient>(out.B->Real(), mat_op);
+    if (HasImag())
+    {
+      out.Bsi = std::make_unique<BdrFieldVectorCoefficient>(out.B->Imag(), mat_op);
+      out.Jsi = std::make_unique<BdrCurrentVectorCoefficient>(out.B->Imag(), mat_op);
+    }
+    out.Um = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::MAGNETIC>>(
+        *out.B, mat_op);
+  }
+  if (out.V)
+  {
+    out.Vs = std::make_unique<BdrFieldCoefficient>(out.V->Real(), mat_op);
+  }
+  if (out.A)
+  {
+    out.As = std::make_unique<BdrFieldVectorCoefficient>(out.A->Real(), mat_op);
+  }
+  paraview.SetMesh(out.mesh.get());
+  paraview_bdr.SetMesh(out.mesh.get());
 
   // Output fields @ phase = 0 and π/2 for frequency domain (rather than, for example,
   // peak phasors or magnitude = sqrt(2) * RMS). Also output fields evaluated on mesh
@@ -173,82 +264,82 @@ void PostOperator::InitializeDataCollection(const IoData &iodata)
   {
     if (HasImag())
     {
-      paraview.RegisterField("E_real", &E->Real());
-      paraview.RegisterField("E_imag", &E->Imag());
-      paraview_bdr.RegisterVCoeffField("E_real", Esr.get());
-      paraview_bdr.RegisterVCoeffField("E_imag", Esi.get());
+      paraview.RegisterField("E_real", &out.E->Real());
+      paraview.RegisterField("E_imag", &out.E->Imag());
+      paraview_bdr.RegisterVCoeffField("E_real", out.Esr.get());
+      paraview_bdr.RegisterVCoeffField("E_imag", out.Esi.get());
     }
     else
     {
-      paraview.RegisterField("E", &E->Real());
-      paraview_bdr.RegisterVCoeffField("E", Esr.get());
+      paraview.RegisterField("E", &out.E->Real());
+      paraview_bdr.RegisterVCoeffField("E", out.Esr.get());
     }
   }
   if (B)
   {
     if (HasImag())
     {
-      paraview.RegisterField("B_real", &B->Real());
-      paraview.RegisterField("B_imag", &B->Imag());
-      paraview_bdr.RegisterVCoeffField("B_real", Bsr.get());
-      paraview_bdr.RegisterVCoeffField("B_imag", Bsi.get());
+      paraview.RegisterField("B_real", &out.B->Real());
+      paraview.RegisterField("B_imag", &out.B->Imag());
+      paraview_bdr.RegisterVCoeffField("B_real", out.Bsr.get());
+      paraview_bdr.RegisterVCoeffField("B_imag", out.Bsi.get());
     }
     else
     {
-      paraview.RegisterField("B", &B->Real());
-      paraview_bdr.RegisterVCoeffField("B", Bsr.get());
+      paraview.RegisterField("B", &out.B->Real());
+      paraview_bdr.RegisterVCoeffField("B", out.Bsr.get());
     }
   }
   if (V)
   {
-    paraview.RegisterField("V", &V->Real());
-    paraview_bdr.RegisterCoeffField("V", Vs.get());
+    paraview.RegisterField("V", &out.V->Real());
+    paraview_bdr.RegisterCoeffField("V", out.Vs.get());
   }
   if (A)
   {
-    paraview.RegisterField("A", &A->Real());
-    paraview_bdr.RegisterVCoeffField("A", As.get());
+    paraview.RegisterField("A", &out.A->Real());
+    paraview_bdr.RegisterVCoeffField("A", out.As.get());
   }
 
   // Extract surface charge from normally discontinuous ND E-field. Also extract surface
   // currents from tangentially discontinuous RT B-field The surface charge and surface
   // currents are single-valued at internal boundaries.
-  if (Qsr)
+  if (out.Qsr)
   {
     if (HasImag())
     {
-      paraview_bdr.RegisterCoeffField("Qs_real", Qsr.get());
-      paraview_bdr.RegisterCoeffField("Qs_imag", Qsi.get());
+      paraview_bdr.RegisterCoeffField("Qs_real", out.Qsr.get());
+      paraview_bdr.RegisterCoeffField("Qs_imag", out.Qsi.get());
     }
     else
     {
-      paraview_bdr.RegisterCoeffField("Qs", Qsr.get());
+      paraview_bdr.RegisterCoeffField("Qs", out.Qsr.get());
     }
   }
-  if (Jsr)
+  if (out.Jsr)
   {
     if (HasImag())
     {
-      paraview_bdr.RegisterVCoeffField("Js_real", Jsr.get());
-      paraview_bdr.RegisterVCoeffField("Js_imag", Jsi.get());
+      paraview_bdr.RegisterVCoeffField("Js_real", out.Jsr.get());
+      paraview_bdr.RegisterVCoeffField("Js_imag", out.Jsi.get());
     }
     else
     {
-      paraview_bdr.RegisterVCoeffField("Js", Jsr.get());
+      paraview_bdr.RegisterVCoeffField("Js", out.Jsr.get());
     }
   }
 
   // Extract energy density field for electric field energy 1/2 Dᴴ E or magnetic field
   // energy 1/2 Bᴴ H.
-  if (Ue)
+  if (out.Ue)
   {
-    paraview.RegisterCoeffField("Ue", Ue.get());
-    paraview_bdr.RegisterCoeffField("Ue", Ue.get());
+    paraview.RegisterCoeffField("Ue", out.Ue.get());
+    paraview_bdr.RegisterCoeffField("Ue", out.Ue.get());
   }
-  if (Um)
+  if (out.Um)
   {
-    paraview.RegisterCoeffField("Um", Um.get());
-    paraview_bdr.RegisterCoeffField("Um", Um.get());
+    paraview.RegisterCoeffField("Um", out.Um.get());
+    paraview_bdr.RegisterCoeffField("Um", out.Um.get());
   }
 
   // Add wave port boundary mode postprocessing when available.
@@ -259,6 +350,16 @@ void PostOperator::InitializeDataCollection(const IoData &iodata)
   }
 }
 
+void PostOperator::WaitFields() const
+{
+  if (output_thread.joinable())
+  {
+    output_thread.join();
+  }
+  paraview.FinishSave();
+  paraview_bdr.FinishSave();
+}
+
 void PostOperator::SetEGridFunction(const ComplexVector &e, bool exchange_face_nbr_data)
 {
   MFEM_VERIFY(HasImag(),
@@ -271,7 +372,7 @@ void PostOperator::SetEGridFunction(const ComplexVector &e, bool exchange_face_n
     E->Real().ExchangeFaceNbrData();  // Ready for parallel comm on shared faces
     E->Imag().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = domain_E_init = false;
 }
 
 void PostOperator::SetBGridFunction(const ComplexVector &b, bool exchange_face_nbr_data)
@@ -286,7 +387,7 @@ void PostOperator::SetBGridFunction(const ComplexVector &b, bool exchange_face_n
     B->Real().ExchangeFaceNbrData();  // Ready for parallel comm on shared faces
     B->Imag().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = domain_E_init = false;
 }
 
 void PostOperator::SetEGridFunction(const Vector &e, bool exchange_face_nbr_data)
@@ -299,7 +400,7 @@ void PostOperator::SetEGridFunction(const Vector &e, bool exchange_face_nbr_data
   {
     E->Real().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = domain_E_init = false;
 }
 
 void PostOperator::SetBGridFunction(const Vector &b, bool exchange_face_nbr_data)
@@ -312,7 +413,7 @@ void PostOperator::SetBGridFunction(const Vector &b, bool exchange_face_nbr_data
   {
     B->Real().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = domain_E_init = false;
 }
 
 void PostOperator::SetVGridFunction(const Vector &v, bool exchange_face_nbr_data)
@@ -325,6 +426,7 @@ void PostOperator::SetVGridFunction(const Vector &v, bool exchange_face_nbr_data
   {
     V->Real().ExchangeFaceNbrData();
   }
+  domain_E_init = false;
 }
 
 void PostOperator::SetAGridFunction(const Vector &a, bool exchange_face_nbr_data)
@@ -337,58 +439,75 @@ void PostOperator::SetAGridFunction(const Vector &a, bool exchange_face_nbr_data
   {
     A->Real().ExchangeFaceNbrData();
   }
+  domain_E_init = false;
 }
 
-double PostOperator::GetEFieldEnergy() const
+void PostOperator::UpdateDomainEnergies() const
 {
-  if (V)
-  {
-    return dom_post_op.GetElectricFieldEnergy(*V);
-  }
-  else
+  // Compute the total and all postprocessing domain energies together, with a single global
+  // reduction.
+  if (domain_E_init)
   {
-    MFEM_VERIFY(E, "PostOperator is not configured for electric field energy calculation!");
-    return dom_post_op.GetElectricFieldEnergy(*E);
+    return;
   }
+  const GridFunction *U_elec = V ? &*V : (E ? &*E : nullptr);
+  const GridFunction *U_mag = A ? &*A : (B ? &*B : nullptr);
+  dom_post_op.GetFieldEnergies(U_elec, U_mag, E_elec, E_mag, domain_E);
+  domain_E_init = true;
+}
+
+double PostOperator::GetEFieldEnergy() const
+{
+  MFEM_VERIFY(V || E,
+              "PostOperator is not configured for electric field energy calculation!");
+  UpdateDomainEnergies();
+  return E_elec;
 }
 
 double PostOperator::GetHFieldEnergy() const
 {
-  if (A)
-  {
-    return dom_post_op.GetMagneticFieldEnergy(*A);
-  }
-  else
-  {
-    MFEM_VERIFY(B, "PostOperator is not configured for magnetic field energy calculation!");
-    return dom_post_op.GetMagneticFieldEnergy(*B);
-  }
+  MFEM_VERIFY(A || B,
+              "PostOperator is not configured for magnetic field energy calculation!");
+  UpdateDomainEnergies();
+  return E_mag;
+}
+
+void PostOperator::GetEFieldEnergyMatrix(const std::vector<Vector> &V,
+                                         mfem::DenseMatrix &W) const
+{
+  MFEM_VERIFY(this->V, "PostOperator is not configured for electric field energy matrix "
+                       "calculation!");
+  dom_post_op.GetElectricFieldEnergyMatrix(V, *this->V->ParFESpace(), W);
+}
+
+void PostOperator::GetHFieldEnergyMatrix(const std::vector<Vector> &A,
+                                         mfem::DenseMatrix &W) const
+{
+  MFEM_VERIFY(this->A, "PostOperator is not configured for magnetic field energy matrix "
+                       "calculation!");
+  dom_post_op.GetMagneticFieldEnergyMatrix(A, *this->A->ParFESpace(), W);
 }
 
 double PostOperator::GetEFieldEnergy(int idx) const
 {
-  if (V)
-  {
-    return dom_post_op.GetDomainElectricFieldEnergy(idx, *V);
-  }
-  else
-  {
-    MFEM_VERIFY(E, "PostOperator is not configured for electric field energy calculation!");
-    return dom_post_op.GetDomainElectricFieldEnergy(idx, *E);
-  }
+  MFEM_VERIFY(V || E,
+              "PostOperator is not configured for electric field energy calculation!");
+  UpdateDomainEnergies();
+  auto it = domain_E.find(idx);
+  MFEM_VERIFY(it != domain_E.end(),
+              "Invalid domain index when postprocessing domain electric field energy!");
+  return it->second.first;
 }
 
 double PostOperator::GetHFieldEnergy(int idx) const
 {
-  if (A)
-  {
-    return dom_post_op.GetDomainMagneticFieldEnergy(idx, *A);
-  }
-  else
-  {
-    MFEM_VERIFY(B, "PostOperator is not configured for magnetic field energy calculation!");
-    return dom_post_op.GetDomainMagneticFieldEnergy(idx, *B);
-  }
+  MFEM_VERIFY(A || B,
+              "PostOperator is not configured for magnetic field energy calculation!");
+  UpdateDomainEnergies();
+  auto it = domain_E.find(idx);
+  MFEM_VERIFY(it != domain_E.end(),
+              "Invalid domain index when postprocessing domain magnetic field energy!");
+  return it->second.second;
 }
 
 void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double omega)
@@ -405,23 +524,8 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
     vi.V = data.GetVoltage(*E);
     if (HasImag())
     {
-      // Compute current from the port impedance, separate contributions for R, L, C
-      // branches.
-      MFEM_VERIFY(
-          omega > 0.0,
-          "Frequency domain lumped port postprocessing requires nonzero frequency!");
-      vi.I[0] =
-          (std::abs(data.R) > 0.0)
-              ? vi.V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::R)
-              : 0.0;
-      vi.I[1] =
-          (std::abs(data.L) > 0.0)
-              ? vi.V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::L)
-              : 0.0;
-      vi.I[2] =
-          (std::abs(data.C) > 0.0)
-              ? vi.V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::C)
-              : 0.0;
+      const auto I = GetLumpedPortCurrents(data, vi.V, omega);
+      std::copy(I.begin(), I.end(), vi.I);
       vi.S = data.GetSParameter(*E);
     }
     else
@@ -434,6 +538,23 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
   lumped_port_init = true;
 }
 
+void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op,
+                               const std::map<int, std::complex<double>> &V,
+                               const std::map<int, std::complex<double>> &S, double omega)
+{
+  MFEM_VERIFY(HasImag(), "Incorrect usage of PostOperator::UpdatePorts!");
+  for (const auto &[idx, data] : lumped_port_op)
+  {
+    auto &vi = lumped_port_vi[idx];
+    vi.P = 0.0;
+    vi.V = V.at(idx);
+    const auto I = GetLumpedPortCurrents(data, vi.V, omega);
+    std::copy(I.begin(), I.end(), vi.I);
+    vi.S = S.at(idx);
+  }
+  lumped_port_init = true;
+}
+
 void PostOperator::UpdatePorts(const WavePortOperator &wave_port_op, double omega)
 {
   MFEM_VERIFY(HasImag() && E && B, "Incorrect usage of PostOperator::UpdatePorts!");
@@ -675,97 +796,110 @@ double PostOperator::GetSurfaceFlux(int idx) const
 void PostOperator::WriteFields(int step, double time, const ErrorIndicator *indicator) const
 {
   // Given the electric field and magnetic flux density, write the fields to disk for
-  // visualization. Write the mesh coordinates in the same units as originally input.
+  // visualization. Write the mesh coordinates in the same units as originally input. The
+  // fields are copied into the output grid functions and, when MFEM is built thread-safe,
+  // the compression and file I/O is performed on a background thread, overlapping with the
+  // continuing solve. Only one write is in flight at a time.
   bool first_save = (paraview.GetCycle() < 0);
-  mfem::ParMesh &mesh =
-      HasE() ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
-  auto ScaleGridFunctions = [&mesh, this](double L)
-  {
-    // For fields on H(curl) and H(div) spaces, we "undo" the effect of redimensionalizing
-    // the mesh which would carry into the fields during the mapping from reference to
-    // physical space through the element Jacobians. No transformation for V is needed (H1
-    // interpolation). Because the coefficients are always evaluating E, B in neighboring
-    // elements, the Jacobian scaling is the same for the domain and boundary data
-    // collections (instead of being different for B due to the dim - 1 evaluation). Wave
-    // port fields also do not require rescaling since their submesh object where they are
-    // evaluated remains nondimensionalized.
-    if (E)
-    {
-      // Piola transform: J^-T
-      E->Real() *= L;
-      E->Real().FaceNbrData() *= L;
-      if (HasImag())
-      {
-        E->Imag() *= L;
-        E->Imag().FaceNbrData() *= L;
-      }
-    }
-    if (B)
+  if (!output)
+  {
+    InitializeOutputData();
+  }
+  WaitFields();
+  auto &out = *output;
+  auto CopyGridFunction = [](const mfem::ParGridFunction &u, mfem::ParGridFunction &v,
+                             double s)
+  {
+    v.Set(s, u);
+    v.FaceNbrData().SetSize(u.FaceNbrData().Size());
+    v.FaceNbrData().Set(s, u.FaceNbrData());
+  };
+
+  // For fields on H(curl) and H(div) spaces, we "undo" the effect of redimensionalizing the
+  // mesh which would carry into the fields during the mapping from reference to physical
+  // space through the element Jacobians. No transformation for V is needed (H1
+  // interpolation). Because the coefficients are always evaluating E, B in neighboring
+  // elements, the Jacobian scaling is the same for the domain and boundary data collections
+  // (instead of being different for B due to the dim - 1 evaluation). Wave port fields also
+  // do not require rescaling since their submesh object where they are evaluated remains
+  // nondimensionalized.
+  if (E)
+  {
+    // Piola transform: J^-T
+    CopyGridFunction(E->Real(), out.E->Real(), mesh_Lc0);
+    if (HasImag())
     {
-      // Piola transform: J / |J|
-      const auto Ld = std::pow(L, mesh.Dimension() - 1);
-      B->Real() *= Ld;
-      B->Real().FaceNbrData() *= Ld;
-      if (HasImag())
-      {
-        B->Imag() *= Ld;
-        B->Imag().FaceNbrData() *= Ld;
-      }
+      CopyGridFunction(E->Imag(), out.E->Imag(), mesh_Lc0);
     }
-    if (A)
+  }
+  if (B)
+  {
+    // Piola transform: J / |J|
+    const auto Ld = std::pow(mesh_Lc0, out.mesh->Dimension() - 1);
+    CopyGridFunction(B->Real(), out.B->Real(), Ld);
+    if (HasImag())
     {
-      // Piola transform: J^-T
-      A->Real() *= L;
-      A->Real().FaceNbrData() *= L;
+      CopyGridFunction(B->Imag(), out.B->Imag(), Ld);
     }
-  };
-  mesh::DimensionalizeMesh(mesh, mesh_Lc0);
-  ScaleGridFunctions(mesh_Lc0);
+  }
+  if (V)
+  {
+    CopyGridFunction(V->Real(), out.V->Real(), 1.0);
+  }
+  if (A)
+  {
+    // Piola transform: J^-T
+    CopyGridFunction(A->Real(), out.A->Real(), mesh_Lc0);
+  }
+
+  // The rank is only written for the first cycle and the error indicator only when
+  // provided.
+  if (paraview.HasField("Rank"))
+  {
+    paraview.DeregisterField("Rank");
+  }
+  if (paraview.HasField("Indicator"))
+  {
+    paraview.DeregisterField("Indicator");
+  }
+  if (first_save)
+  {
+    paraview.RegisterField("Rank", out.rank.get());
+  }
+  if (indicator)
+  {
+    MFEM_VERIFY(out.eta->Size() == indicator->Local().Size(),
+                "Size mismatch for provided ErrorIndicator for postprocessing!");
+    *out.eta = indicator->Local();
+    paraview.RegisterField("Indicator", out.eta.get());
+  }
 
   paraview.SetCycle(step);
   paraview.SetTime(time);
   paraview_bdr.SetCycle(step);
   paraview_bdr.SetTime(time);
-  if (first_save || indicator)
-  {
-    // No need for these to be parallel objects, since the data is local to each process and
-    // there isn't a need to ever access the element neighbors.
-    mfem::L2_FECollection pwconst_fec(0, mesh.Dimension());
-    mfem::FiniteElementSpace pwconst_fespace(&mesh, &pwconst_fec);
-    std::unique_ptr<mfem::GridFunction> rank, eta;
-    if (first_save)
-    {
-      rank = std::make_unique<mfem::GridFunction>(&pwconst_fespace);
-      *rank = mesh.GetMyRank() + 1;
-      paraview.RegisterField("Rank", rank.get());
-    }
-    if (indicator)
-    {
-      eta = std::make_unique<mfem::GridFunction>(&pwconst_fespace);
-      MFEM_VERIFY(eta->Size() == indicator->Local().Size(),
-                  "Size mismatch for provided ErrorIndicator for postprocessing!");
-      *eta = indicator->Local();
-      paraview.RegisterField("Indicator", eta.get());
-    }
-    paraview.Save();
-    if (rank)
-    {
-      paraview.DeregisterField("Rank");
-    }
-    if (eta)
-    {
-      paraview.DeregisterField("Indicator");
-    }
-  }
-  else
+  paraview.BeginSave();
+  paraview_bdr.BeginSave();
+
+  // Writing evaluates the field coefficients and element shape functions, which share
+  // scratch storage across threads unless MFEM is built thread-safe (MFEM_THREAD_SAFE). The
+  // wave port mode fields also reference data owned by the wave port operator, and device
+  // memory is not safe to access from a separate host thread, so write synchronously in
+  // these cases. Both collections share the output mesh, so are written in sequence.
+  auto Write = [this]()
+  {
+    paraview.EndSave();
+    paraview_bdr.EndSave();
+  };
+#if defined(MFEM_THREAD_SAFE)
+  if (port_E0.empty() && !mfem::Device::Allows(mfem::Backend::DEVICE_MASK))
   {
-    paraview.Save();
+    output_thread = std::thread(Write);
+    return;
   }
-  paraview_bdr.Save();
-
-  // Restore the mesh nondimensionalization.
-  mesh::NondimensionalizeMesh(mesh, mesh_Lc0);
-  ScaleGridFunctions(1.0 / mesh_Lc0);
+#endif
+  Write();
+  WaitFields();
 }
 
 std::vector<std::complex<double>> PostOperator::ProbeEField() const
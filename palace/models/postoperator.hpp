@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 #include <mfem.hpp>
 #include "fem/gridfunction.hpp"
@@ -18,6 +19,7 @@
 #include "models/domainpostoperator.hpp"
 #include "models/lumpedportoperator.hpp"
 #include "models/surfacepostoperator.hpp"
+#include "utils/paraview.hpp"
 
 namespace palace
 {
@@ -46,8 +48,6 @@ private:
 
   // Objects for grid function postprocessing from the FE solution.
   mutable std::optional<GridFunction> E, B, V, A;
-  std::unique_ptr<mfem::VectorCoefficient> Esr, Esi, Bsr, Bsi, As, Jsr, Jsi;
-  std::unique_ptr<mfem::Coefficient> Vs, Ue, Um, Qsr, Qsi;
 
   // Wave port boundary mode field postprocessing.
   struct WavePortFieldData
@@ -65,16 +65,34 @@ private:
   std::map<int, PortPostData> lumped_port_vi, wave_port_vi;
   bool lumped_port_init, wave_port_init;
 
+  // Total and postprocessing domain electric and magnetic field energy caches, computed
+  // together on first access after the grid functions are set.
+  mutable std::map<int, std::pair<double, double>> domain_E;
+  mutable double E_elec, E_mag;
+  mutable bool domain_E_init;
+  void UpdateDomainEnergies() const;
+
   // Data collection for writing fields to disk for visualization and sampling points.
-  mutable mfem::ParaViewDataCollection paraview, paraview_bdr;
+  mutable AsyncParaViewDataCollection paraview, paraview_bdr;
   mutable InterpolationOperator interp_op;
   double mesh_Lc0;
   void InitializeDataCollection(const IoData &iodata);
 
+  // Copies of the grid functions on a dimensionalized copy of the mesh, along with the
+  // coefficients for boundary field output, constructed on the first call to WriteFields.
+  // Fields are copied here and then, when MFEM is built thread-safe, written on a
+  // background thread while the solve continues.
+  struct OutputData;
+  mutable std::unique_ptr<OutputData> output;
+  mutable std::thread output_thread;
+  void InitializeOutputData() const;
+  void WaitFields() const;
+
 public:
   PostOperator(const IoData &iodata, SpaceOperator &spaceop, const std::string &name);
   PostOperator(const IoData &iodata, LaplaceOperator &laplaceop, const std::string &name);
   PostOperator(const IoData &iodata, CurlCurlOperator &curlcurlop, const std::string &name);
+  ~PostOperator();
 
   // Access to surface and domain postprocessing objects.
   const auto &GetSurfacePostOp() const { return surf_post_op; }
@@ -101,6 +119,12 @@ public:
   double GetEFieldEnergy() const;
   double GetHFieldEnergy() const;
 
+  // Postprocess the matrix of mutual electric or magnetic field energies for a set of
+  // electric scalar or magnetic vector potential solutions on the true dofs,
+  // W_ij = (x_i, K x_j). The total field energy for x_i is 1/2 W_ii.
+  void GetEFieldEnergyMatrix(const std::vector<Vector> &V, mfem::DenseMatrix &W) const;
+  void GetHFieldEnergyMatrix(const std::vector<Vector> &A, mfem::DenseMatrix &W) const;
+
   // Postprocess the electric and magnetic field energies in the domain with the given
   // index.
   double GetEFieldEnergy(int idx) const;
@@ -116,6 +140,13 @@ public:
   void UpdatePorts(const LumpedPortOperator &lumped_port_op, double omega = 0.0);
   void UpdatePorts(const WavePortOperator &wave_port_op, double omega = 0.0);
 
+  // Update cached lumped port voltages, currents, and S-parameters from externally computed
+  // port voltages and S-parameters (for example, from a reduced-order model), without
+  // requiring the field solution. Port powers are not available in this case.
+  void UpdatePorts(const LumpedPortOperator &lumped_port_op,
+                   const std::map<int, std::complex<double>> &V,
+                   const std::map<int, std::complex<double>> &S, double omega);
+
   // Postprocess the energy in lumped capacitor or inductor port boundaries with index in
   // the provided set.
   double GetLumpedInductorEnergy(const LumpedPortOperator &lumped_port_op) const;
@@ -161,7 +192,9 @@ public:
 
   // Write to disk the E- and B-fields extracted from the solution vectors. Note that fields
   // are not redimensionalized, to do so one needs to compute: B <= B * (μ₀ H₀), E <= E *
-  // (Z₀ H₀), V <= V * (Z₀ H₀ L₀), etc.
+  // (Z₀ H₀), V <= V * (Z₀ H₀ L₀), etc. When MFEM is built thread-safe, the write is
+  // completed asynchronously, and the next call to WriteFields (or the destructor) waits
+  // for it to finish.
   void WriteFields(int step, double time, const ErrorIndicator *indicator = nullptr) const;
 
   // Probe the E- and B-fields for their vector-values at speceified locations in space.
@@ -3,11 +3,16 @@
 
 #include "romoperator.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
 #include <Eigen/SVD>
 #include <mfem.hpp>
+#include <nlohmann/json.hpp>
 #include "linalg/orthog.hpp"
 #include "models/spaceoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
 #include "utils/iodata.hpp"
 #include "utils/timer.hpp"
 
@@ -24,6 +29,7 @@ extern "C"
 namespace palace
 {
 
+using json = nlohmann::json;
 using namespace std::complex_literals;
 
 namespace
@@ -32,11 +38,12 @@ namespace
 constexpr auto ORTHOG_TOL = 1.0e-12;
 
 template <typename VecType, typename ScalarType>
-inline void OrthogonalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
-                                const std::vector<VecType> &V, VecType &w, ScalarType *Rj,
-                                int j)
+inline double OrthogonalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
+                                  const std::vector<VecType> &V, VecType &w, ScalarType *Rj,
+                                  int j)
 {
-  // Orthogonalize w against the leading j columns of V.
+  // Orthogonalize w against the leading j columns of V, returning the norm of the
+  // orthogonalized vector.
   switch (type)
   {
     case GmresSolverBase::OrthogType::MGS:
@@ -48,42 +55,54 @@ inline void OrthogonalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
     case GmresSolverBase::OrthogType::CGS2:
       linalg::OrthogonalizeColumnCGS(comm, V, w, Rj, j, true);
       break;
+    case GmresSolverBase::OrthogType::CGS_FUSED:
+      return linalg::OrthogonalizeColumnCGSFused(comm, V, w, Rj, j);
+    case GmresSolverBase::OrthogType::CGS2_FUSED:
+      return linalg::OrthogonalizeColumnCGSFused(comm, V, w, Rj, j, true);
   }
+  return linalg::Norml2(comm, w);
 }
 
-inline void ProjectMatInternal(MPI_Comm comm, const std::vector<Vector> &V,
-                               const ComplexOperator &A, Eigen::MatrixXcd &Ar,
-                               ComplexVector &r, int n0)
+inline void ProjectMatLocal(const std::vector<Vector> &V, const ComplexOperator &A,
+                            Eigen::MatrixXcd &Ar, ComplexVector &r, int n0)
 {
-  // Update Ar = Vᴴ A V for the new basis dimension n0 -> n. V is real and thus the result
-  // is complex symmetric if A is symmetric (which we assume is the case). Ar is replicated
-  // across all processes as a sequential n x n matrix.
+  // Compute the local contributions to the new columns n0 -> n of Ar = Vᴴ A V. The global
+  // reduction is performed separately so that it can be fused for multiple operators.
   const auto n = Ar.rows();
   MFEM_VERIFY(n0 < n, "Invalid dimensions in PROM matrix projection!");
+  MFEM_VERIFY(A.Real() || A.Imag(),
+              "Invalid zero ComplexOperator for PROM matrix projection!");
+  std::vector<double> dots(n);
   for (int j = n0; j < n; j++)
   {
     // Fill block of Vᴴ A V = [  | Vᴴ A vj ] . We can optimize the matrix-vector product
     // since the columns of V are real.
-    MFEM_VERIFY(A.Real() || A.Imag(),
-                "Invalid zero ComplexOperator for PROM matrix projection!");
     if (A.Real())
     {
       A.Real()->Mult(V[j], r.Real());
+      linalg::LocalDots(r.Real(), V, dots.data(), n);
+    }
+    for (int i = 0; i < n; i++)
+    {
+      Ar(i, j).real(A.Real() ? dots[i] : 0.0);
     }
     if (A.Imag())
     {
       A.Imag()->Mult(V[j], r.Imag());
+      linalg::LocalDots(r.Imag(), V, dots.data(), n);
     }
     for (int i = 0; i < n; i++)
     {
-      Ar(i, j).real(A.Real() ? V[i] * r.Real() : 0.0);  // Local inner product
-      Ar(i, j).imag(A.Imag() ? V[i] * r.Imag() : 0.0);
+      Ar(i, j).imag(A.Imag() ? dots[i] : 0.0);
     }
   }
-  Mpi::GlobalSum((n - n0) * n, Ar.data() + n0 * n, comm);
+}
 
+inline void SymmetrizeProjectedMat(Eigen::MatrixXcd &Ar, int n0)
+{
   // Fill lower block of Vᴴ A V = [ ____________  |  ]
   //                              [ vjᴴ A V[1:n0] |  ] .
+  const auto n = Ar.rows();
   for (int j = 0; j < n0; j++)
   {
     for (int i = n0; i < n; i++)
@@ -93,11 +112,23 @@ inline void ProjectMatInternal(MPI_Comm comm, const std::vector<Vector> &V,
   }
 }
 
-inline void ProjectVecInternal(MPI_Comm comm, const std::vector<Vector> &V,
-                               const ComplexVector &b, Eigen::VectorXcd &br, int n0)
+inline void ProjectMatInternal(MPI_Comm comm, const std::vector<Vector> &V,
+                               const ComplexOperator &A, Eigen::MatrixXcd &Ar,
+                               ComplexVector &r, int n0)
 {
-  // Update br = Vᴴ b for the new basis dimension n0 -> n. br is replicated across all
-  // processes as a sequential n-dimensional vector.
+  // Update Ar = Vᴴ A V for the new basis dimension n0 -> n. V is real and thus the result
+  // is complex symmetric if A is symmetric (which we assume is the case). Ar is replicated
+  // across all processes as a sequential n x n matrix.
+  const auto n = Ar.rows();
+  ProjectMatLocal(V, A, Ar, r, n0);
+  Mpi::GlobalSum((n - n0) * n, Ar.data() + n0 * n, comm);
+  SymmetrizeProjectedMat(Ar, n0);
+}
+
+inline void ProjectVecLocal(const std::vector<Vector> &V, const ComplexVector &b,
+                            Eigen::VectorXcd &br, int n0)
+{
+  // Compute the local contributions to the new entries n0 -> n of br = Vᴴ b.
   const auto n = br.size();
   MFEM_VERIFY(n0 < n, "Invalid dimensions in PROM vector projection!");
   for (int i = n0; i < n; i++)
@@ -105,6 +136,15 @@ inline void ProjectVecInternal(MPI_Comm comm, const std::vector<Vector> &V,
     br(i).real(V[i] * b.Real());  // Local inner product
     br(i).imag(V[i] * b.Imag());
   }
+}
+
+inline void ProjectVecInternal(MPI_Comm comm, const std::vector<Vector> &V,
+                               const ComplexVector &b, Eigen::VectorXcd &br, int n0)
+{
+  // Update br = Vᴴ b for the new basis dimension n0 -> n. br is replicated across all
+  // processes as a sequential n-dimensional vector.
+  const auto n = br.size();
+  ProjectVecLocal(V, b, br, n0);
   Mpi::GlobalSum(n - n0, br.data() + n0, comm);
 }
 
@@ -184,6 +224,26 @@ inline void ProlongatePROMSolution(std::size_t n, const std::vector<Vector> &V,
   }
 }
 
+std::string GetBasisDir(const std::string &dir)
+{
+  return (dir.length() > 0 && dir.back() != '/') ? dir + '/' : dir;
+}
+
+std::string GetBasisRankFile(const std::string &dir, int rank)
+{
+  return fmt::format("{}rank{:06d}.bin", dir, rank);
+}
+
+inline void WriteBinary(std::ofstream &fo, const Vector &v)
+{
+  fo.write(reinterpret_cast<const char *>(v.HostRead()), v.Size() * sizeof(double));
+}
+
+inline void ReadBinary(std::ifstream &fi, Vector &v)
+{
+  fi.read(reinterpret_cast<char *>(v.HostWrite()), v.Size() * sizeof(double));
+}
+
 }  // namespace
 
 RomOperator::RomOperator(const IoData &iodata, SpaceOperator &spaceop, int max_size)
@@ -217,6 +277,7 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &spaceop, int max_s
   // matrix.
   ksp = std::make_unique<ComplexKspSolver>(iodata, spaceop.GetNDSpaces(),
                                            &spaceop.GetH1Spaces());
+  batch_pc_reuse = (iodata.solver.linear.pc_reuse_its_growth > 0.0);
 
   // The initial PROM basis is empty. The provided maximum dimension is the number of sample
   // points (2 basis vectors per point). Basis orthogonalization method is configured using
@@ -236,10 +297,16 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &spaceop, int max_s
     case config::LinearSolverData::OrthogType::CGS2:
       orthog_type = GmresSolverBase::OrthogType::CGS2;
       break;
+    case config::LinearSolverData::OrthogType::CGS_FUSED:
+      orthog_type = GmresSolverBase::OrthogType::CGS_FUSED;
+      break;
+    case config::LinearSolverData::OrthogType::CGS2_FUSED:
+      orthog_type = GmresSolverBase::OrthogType::CGS2_FUSED;
+      break;
   }
 }
 
-void RomOperator::SolveHDM(double omega, ComplexVector &u)
+void RomOperator::SolveHDM(double omega, ComplexVector &u, bool update_pc)
 {
   // Compute HDM solution at the given frequency. The system matrix, A = K + iω C - ω² M +
   // A2(ω) is built by summing the underlying operator contributions.
@@ -248,9 +315,15 @@ void RomOperator::SolveHDM(double omega, ComplexVector &u)
   auto A = spaceop.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
                                    std::complex<double>(-omega * omega, 0.0), K.get(),
                                    C.get(), M.get(), A2.get());
-  auto P =
-      spaceop.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega, omega);
-  ksp->SetOperators(*A, *P);
+  if (update_pc)
+  {
+    P = spaceop.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega, omega);
+    ksp->SetOperators(*A, *P);
+  }
+  else
+  {
+    ksp->SetOperator(*A);
+  }
 
   // The HDM excitation vector is computed as RHS = iω RHS1 + RHS2(ω).
   Mpi::Print("\n");
@@ -271,6 +344,19 @@ void RomOperator::SolveHDM(double omega, ComplexVector &u)
   ksp->Mult(r, u);
 }
 
+void RomOperator::SolveHDM(const std::vector<double> &omega, std::vector<ComplexVector> &u)
+{
+  // Solve the HDM at each frequency of the batch. If enabled, the preconditioner is
+  // constructed only for the first frequency and reused for the rest of the batch.
+  u.resize(omega.size());
+  for (std::size_t i = 0; i < omega.size(); i++)
+  {
+    u[i].SetSize(r.Size());
+    u[i].UseDevice(true);
+    SolveHDM(omega[i], u[i], (i == 0 || !batch_pc_reuse));
+  }
+}
+
 void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
 {
   // Update V. The basis is always real (each complex solution adds two basis vectors if it
@@ -288,43 +374,153 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
   if (has_real)
   {
     V[dim_V] = u.Real();
-    OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
-    H[dim_V] = linalg::Norml2(comm, V[dim_V]);
+    H[dim_V] = OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
     V[dim_V] *= 1.0 / H[dim_V];
     dim_V++;
   }
   if (has_imag)
   {
     V[dim_V] = u.Imag();
-    OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
-    H[dim_V] = linalg::Norml2(comm, V[dim_V]);
+    H[dim_V] = OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
     V[dim_V] *= 1.0 / H[dim_V];
     dim_V++;
   }
 
+  UpdatePROMOperators(dim_V0);
+  UpdateMRI(omega, u);
+}
+
+void RomOperator::UpdatePROM(const std::vector<double> &omega,
+                             const std::vector<ComplexVector> &u)
+{
+  MFEM_VERIFY(omega.size() == u.size(),
+              "Mismatch in number of frequencies and solutions for PROM update!");
+  if (u.size() == 1)
+  {
+    UpdatePROM(omega[0], u[0]);
+    return;
+  }
+
+  // Collect the nonzero real and imaginary parts of the new samples, and orthogonalize them
+  // against the existing basis using block CGS2 with a single global reduction per pass.
+  BlockTimer bt(Timer::CONSTRUCT_PROM);
+  MPI_Comm comm = spaceop.GetComm();
+  std::vector<Vector> W;
+  std::vector<double> norm0;
+  W.reserve(2 * u.size());
+  norm0.reserve(2 * u.size());
+  for (const auto &ui : u)
+  {
+    const double normr = linalg::Norml2(comm, ui.Real());
+    const double normi = linalg::Norml2(comm, ui.Imag());
+    if (normr > ORTHOG_TOL * std::sqrt(normr * normr + normi * normi))
+    {
+      W.push_back(ui.Real());
+      norm0.push_back(normr);
+    }
+    if (normi > ORTHOG_TOL * std::sqrt(normr * normr + normi * normi))
+    {
+      W.push_back(ui.Imag());
+      norm0.push_back(normi);
+    }
+  }
+  MFEM_VERIFY(dim_V + W.size() <= V.size(),
+              "Unable to increase basis storage size, increase maximum number of vectors!");
+  const std::size_t dim_V0 = dim_V;
+  {
+    std::vector<double> H(dim_V0 * W.size());
+    linalg::OrthogonalizeBlockCGS(comm, V, W, H.data(), dim_V0, true);
+  }
+
+  // Orthogonalize the columns of the block against each other, discarding any which are
+  // numerically linearly dependent on the rest of the basis.
+  std::size_t k = 0;
+  std::vector<double> H(W.size());
+  for (std::size_t l = 0; l < W.size(); l++)
+  {
+    if (l != k)
+    {
+      W[k] = W[l];
+    }
+    const double norm =
+        linalg::OrthogonalizeColumnCGSFused(comm, W, W[k], H.data(), k, true);
+    if (norm > ORTHOG_TOL * norm0[l])
+    {
+      W[k] *= 1.0 / norm;
+      k++;
+    }
+  }
+  for (std::size_t l = 0; l < k; l++)
+  {
+    V[dim_V++] = W[l];
+  }
+
+  // Update the reduced-order operators and MRI for all new samples.
+  UpdatePROMOperators(dim_V0);
+  for (std::size_t i = 0; i < u.size(); i++)
+  {
+    UpdateMRI(omega[i], u[i]);
+  }
+}
+
+void RomOperator::UpdatePROMOperators(std::size_t dim_V0)
+{
   // Update reduced-order operators. Resize preserves the upper dim0 x dim0 block of each
   // matrix and first dim0 entries of each vector and the projection uses the values
-  // computed for the unchanged basis vectors.
-  Kr.conservativeResize(dim_V, dim_V);
-  ProjectMatInternal(comm, V, *K, Kr, r, dim_V0);
+  // computed for the unchanged basis vectors. The global reductions for the new entries of
+  // all operators are fused into a single reduction.
+  if (dim_V == dim_V0)
+  {
+    return;
+  }
+  MPI_Comm comm = spaceop.GetComm();
+  std::vector<Eigen::MatrixXcd *> mats = {&Kr, &Mr};
+  std::vector<const ComplexOperator *> ops = {K.get(), M.get()};
   if (C)
   {
-    Cr.conservativeResize(dim_V, dim_V);
-    ProjectMatInternal(comm, V, *C, Cr, r, dim_V0);
+    mats.push_back(&Cr);
+    ops.push_back(C.get());
+  }
+  for (std::size_t k = 0; k < mats.size(); k++)
+  {
+    mats[k]->conservativeResize(dim_V, dim_V);
+    ProjectMatLocal(V, *ops[k], *mats[k], r, dim_V0);
   }
-  Mr.conservativeResize(dim_V, dim_V);
-  ProjectMatInternal(comm, V, *M, Mr, r, dim_V0);
-  Ar.resize(dim_V, dim_V);
   if (RHS1.Size())
   {
     RHS1r.conservativeResize(dim_V);
-    ProjectVecInternal(comm, V, RHS1, RHS1r, dim_V0);
+    ProjectVecLocal(V, RHS1, RHS1r, dim_V0);
   }
+  {
+    const std::size_t mat_size = (dim_V - dim_V0) * dim_V;
+    const std::size_t vec_size = RHS1.Size() ? dim_V - dim_V0 : 0;
+    std::vector<std::complex<double>> buffer(mats.size() * mat_size + vec_size);
+    auto it = buffer.begin();
+    for (auto *mat : mats)
+    {
+      it = std::copy_n(mat->data() + dim_V0 * dim_V, mat_size, it);
+    }
+    std::copy_n(RHS1r.data() + dim_V0, vec_size, it);
+    Mpi::GlobalSum(buffer.size(), buffer.data(), comm);
+    auto cit = buffer.cbegin();
+    for (auto *mat : mats)
+    {
+      std::copy_n(cit, mat_size, mat->data() + dim_V0 * dim_V);
+      cit += mat_size;
+      SymmetrizeProjectedMat(*mat, dim_V0);
+    }
+    std::copy_n(cit, vec_size, RHS1r.data() + dim_V0);
+  }
+  Ar.resize(dim_V, dim_V);
   RHSr.resize(dim_V);
+}
 
+void RomOperator::UpdateMRI(double omega, const ComplexVector &u)
+{
   // Compute the coefficients for the minimal rational interpolation of the state u used
   // as an error indicator. The complex-valued snapshot matrix U = [{u_i, (iω) u_i}] is
   // stored by its QR decomposition.
+  MPI_Comm comm = spaceop.GetComm();
   MFEM_VERIFY(dim_Q + 1 <= Q.size(),
               "Unable to increase basis storage size, increase maximum number of vectors!");
   R.conservativeResizeLike(Eigen::MatrixXd::Zero(dim_Q + 1, dim_Q + 1));
@@ -335,8 +531,8 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
     Q[dim_Q].UseDevice(true);
     Q[dim_Q].SetBlocks(blocks, s);
   }
-  OrthogonalizeColumn(orthog_type, comm, Q, Q[dim_Q], R.col(dim_Q).data(), dim_Q);
-  R(dim_Q, dim_Q) = linalg::Norml2(comm, Q[dim_Q]);
+  R(dim_Q, dim_Q) =
+      OrthogonalizeColumn(orthog_type, comm, Q, Q[dim_Q], R.col(dim_Q).data(), dim_Q);
   Q[dim_Q] *= 1.0 / R(dim_Q, dim_Q);
   dim_Q++;
   ComputeMRI(R, q);
@@ -350,6 +546,12 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
 }
 
 void RomOperator::SolvePROM(double omega, ComplexVector &u)
+{
+  SolvePROM(omega);
+  ProlongatePROMSolution(dim_V, V, RHSr, u);
+}
+
+void RomOperator::SolvePROM(double omega)
 {
   // Assemble the PROM linear system at the given frequency. The PROM system is defined by
   // the matrix Aᵣ(ω) = Kᵣ + iω Cᵣ - ω² Mᵣ + Vᴴ A2 V(ω) and source vector RHSᵣ(ω) =
@@ -385,9 +587,8 @@ void RomOperator::SolvePROM(double omega, ComplexVector &u)
     RHSr += (1i * omega) * RHS1r;
   }
 
-  // Compute PROM solution at the given frequency and expand into high-dimensional space.
-  // The PROM is solved on every process so the matrix-vector product for vector expansion
-  // does not require communication.
+  // Compute PROM solution at the given frequency. The PROM is solved on every process so
+  // the matrix-vector product for vector expansion does not require communication.
   BlockTimer bt(Timer::SOLVE_PROM);
   if constexpr (false)
   {
@@ -400,10 +601,20 @@ void RomOperator::SolvePROM(double omega, ComplexVector &u)
     // LU solve
     RHSr = Ar.partialPivLu().solve(RHSr);
   }
-  ProlongatePROMSolution(dim_V, V, RHSr, u);
 }
 
-std::vector<double> RomOperator::FindMaxError(int N) const
+Eigen::VectorXd RomOperator::ProjectLinearForm(const Vector &f) const
+{
+  Eigen::VectorXd fr(dim_V);
+  for (std::size_t i = 0; i < dim_V; i++)
+  {
+    fr(i) = V[i] * f;  // Local inner product
+  }
+  Mpi::GlobalSum(dim_V, fr.data(), spaceop.GetComm());
+  return fr;
+}
+
+std::vector<double> RomOperator::FindMaxError(int N, double z_min, double z_max) const
 {
   // Return an estimate for argmax_z ||u(z) - V y(z)|| as argmin_z |Q(z)| with Q(z) =
   // sum_i q_z / (z - z_i) (denominator of the barycentric interpolation of u). The roots of
@@ -412,8 +623,8 @@ std::vector<double> RomOperator::FindMaxError(int N) const
   const auto S = dim_Q;
   MFEM_VERIFY(S >= 2, "Maximum error can only be found once two sample points have been "
                       "added to the PROM to define the parameter domain!");
-  double start = *std::min_element(z.begin(), z.end());
-  double end = *std::max_element(z.begin(), z.end());
+  double start = std::max(*std::min_element(z.begin(), z.end()), z_min);
+  double end = std::min(*std::max_element(z.begin(), z.end()), z_max);
   Eigen::Map<const Eigen::VectorXd> z_map(z.data(), S);
   std::vector<std::complex<double>> z_star(N, 0.0);
 
@@ -459,32 +670,59 @@ std::vector<double> RomOperator::FindMaxError(int N) const
   //   }
   // }
 
-  // Fall back to sampling Q on discrete points if no roots exist in [start, end].
+  // Fall back to sampling Q on discrete points if no roots exist in [start, end]. Candidate
+  // points are the local minima of |Q| (local maxima of the error), so that multiple
+  // returned points are not clustered around the same maximum.
   if (std::abs(z_star[0]) == 0.0)
   {
     const auto delta = (end - start) / 1.0e6;
+    auto EvalQ = [this, &z_map](double x)
+    { return std::abs((q.array() / (z_map.array() - x)).sum()); };
     std::vector<double> Q_star(N, mfem::infinity());
-    while (start <= end)
+    int n_star = 0;
+    double x = start + delta, Q_prev = EvalQ(start), Q_x = EvalQ(x);
+    double Q_global = Q_prev, z_global = start;
+    while (x <= end)
     {
-      const double Q = std::abs((q.array() / (z_map.array() - start)).sum());
-      for (int i = 0; i < N; i++)
+      const double Q_next = EvalQ(x + delta);
+      if (Q_x < Q_global)
+      {
+        Q_global = Q_x;
+        z_global = x;
+      }
+      if (Q_x < Q_prev && Q_x <= Q_next)
       {
-        if (Q < Q_star[i])
+        // Insert into the list of the N smallest local minima, sorted in ascending order.
+        for (int i = 0; i < N; i++)
         {
-          for (int j = i + 1; j < N; j++)
+          if (Q_x < Q_star[i])
           {
-            z_star[j] = z_star[j - 1];
-            Q_star[j] = Q_star[j - 1];
+            for (int j = N - 1; j > i; j--)
+            {
+              z_star[j] = z_star[j - 1];
+              Q_star[j] = Q_star[j - 1];
+            }
+            z_star[i] = x;
+            Q_star[i] = Q_x;
+            n_star = std::min(n_star + 1, N);
+            break;
           }
-          z_star[i] = start;
-          Q_star[i] = Q;
         }
       }
-      start += delta;
+      Q_prev = Q_x;
+      Q_x = Q_next;
+      x += delta;
+    }
+    if (N > 0 && n_star == 0 && std::isfinite(Q_global))
+    {
+      // No interior local minimum, use the global minimum on the sampled points.
+      z_star[0] = z_global;
+      n_star = 1;
     }
     MFEM_VERIFY(N == 0 || std::abs(z_star[0]) > 0.0,
                 "Could not locate a maximum error in the range [" << start << ", " << end
                                                                   << "]!");
+    z_star.resize(n_star);
   }
   std::vector<double> vals(z_star.size());
   std::transform(z_star.begin(), z_star.end(), vals.begin(),
@@ -492,6 +730,143 @@ std::vector<double> RomOperator::FindMaxError(int N) const
   return vals;
 }
 
+void RomOperator::SaveBasis(const std::string &dir) const
+{
+  // The JSON index holds the replicated data (sample points and the R factor of the MRI
+  // snapshot matrix), while each process writes its local rows of V and Q.
+  BlockTimer bt(Timer::IO);
+  MPI_Comm comm = spaceop.GetComm();
+  const auto basis_dir = GetBasisDir(dir);
+  if (Mpi::Root(comm))
+  {
+    if (!std::filesystem::exists(basis_dir))
+    {
+      std::filesystem::create_directories(basis_dir);
+    }
+    json index;
+    index["MPISize"] = Mpi::Size(comm);
+    index["GlobalSize"] = spaceop.GlobalTrueVSize();
+    index["Dimension"] = dim_V;
+    index["Samples"] = z;
+    std::vector<double> Rr(dim_Q * dim_Q), Ri(dim_Q * dim_Q);
+    for (std::size_t j = 0; j < dim_Q; j++)
+    {
+      for (std::size_t i = 0; i < dim_Q; i++)
+      {
+        Rr[j * dim_Q + i] = R(i, j).real();
+        Ri[j * dim_Q + i] = R(i, j).imag();
+      }
+    }
+    index["R"]["Real"] = Rr;
+    index["R"]["Imag"] = Ri;
+    std::ofstream fo(basis_dir + "prom.json");
+    if (!fo.is_open())
+    {
+      MFEM_ABORT("Unable to open PROM index file \"" << basis_dir << "prom.json\"!");
+    }
+    fo << index.dump(2) << '\n';
+  }
+  Mpi::Barrier(comm);
+
+  const auto path = GetBasisRankFile(basis_dir, Mpi::Rank(comm));
+  std::ofstream fo(path, std::ios::binary);
+  if (!fo.is_open())
+  {
+    MFEM_ABORT("Unable to open PROM basis file \"" << path << "\"!");
+  }
+  const std::int64_t header[3] = {r.Size(), static_cast<std::int64_t>(dim_V),
+                                  static_cast<std::int64_t>(dim_Q)};
+  fo.write(reinterpret_cast<const char *>(header), sizeof(header));
+  for (std::size_t j = 0; j < dim_V; j++)
+  {
+    WriteBinary(fo, V[j]);
+  }
+  for (std::size_t j = 0; j < dim_Q; j++)
+  {
+    WriteBinary(fo, Q[j].Real());
+    WriteBinary(fo, Q[j].Imag());
+  }
+}
+
+void RomOperator::LoadBasis(const std::string &dir)
+{
+  BlockTimer bt(Timer::IO);
+  MPI_Comm comm = spaceop.GetComm();
+  MFEM_VERIFY(dim_V == 0 && dim_Q == 0,
+              "PROM basis can only be loaded into an empty reduced-order model!");
+  const auto basis_dir = GetBasisDir(dir);
+  json index;
+  {
+    std::ifstream fi(basis_dir + "prom.json");
+    if (!fi.is_open())
+    {
+      MFEM_ABORT("Unable to open PROM index file \"" << basis_dir << "prom.json\"!");
+    }
+    index = json::parse(fi);
+  }
+  MFEM_VERIFY(index["MPISize"].get<int>() == Mpi::Size(comm),
+              "PROM basis was saved using " << index["MPISize"].get<int>()
+                                            << " processes, but the current simulation "
+                                               "uses "
+                                            << Mpi::Size(comm) << "!");
+  MFEM_VERIFY(index["GlobalSize"].get<long long int>() ==
+                  static_cast<long long int>(spaceop.GlobalTrueVSize()),
+              "PROM basis size does not match the current discretization!");
+  const auto n_V = index["Dimension"].get<std::size_t>();
+  auto samples = index["Samples"].get<std::vector<double>>();
+  const auto n_Q = samples.size();
+  const auto Rr = index["R"]["Real"].get<std::vector<double>>();
+  const auto Ri = index["R"]["Imag"].get<std::vector<double>>();
+  MFEM_VERIFY(n_V > 0 && n_Q >= 2 && Rr.size() == n_Q * n_Q && Ri.size() == n_Q * n_Q,
+              "Invalid reduced-order model data in PROM index file!");
+
+  // Read the local portion of the basis vectors, extending the basis storage if necessary.
+  const auto path = GetBasisRankFile(basis_dir, Mpi::Rank(comm));
+  std::ifstream fi(path, std::ios::binary);
+  if (!fi.is_open())
+  {
+    MFEM_ABORT("Unable to open PROM basis file \"" << path << "\"!");
+  }
+  std::int64_t header[3];
+  fi.read(reinterpret_cast<char *>(header), sizeof(header));
+  MFEM_VERIFY(fi && header[0] == r.Size() && static_cast<std::size_t>(header[1]) == n_V &&
+                  static_cast<std::size_t>(header[2]) == n_Q,
+              "PROM basis file \"" << path
+                                     << "\" does not match the current discretization!");
+  V.resize(n_V + V.size(), Vector());
+  Q.resize(n_Q + Q.size(), ComplexVector());
+  for (std::size_t j = 0; j < n_V; j++)
+  {
+    V[j].SetSize(r.Size());
+    V[j].UseDevice(true);
+    ReadBinary(fi, V[j]);
+  }
+  for (std::size_t j = 0; j < n_Q; j++)
+  {
+    Q[j].SetSize(2 * r.Size());
+    Q[j].UseDevice(true);
+    ReadBinary(fi, Q[j].Real());
+    ReadBinary(fi, Q[j].Imag());
+  }
+  MFEM_VERIFY(fi, "Error reading PROM basis file \"" << path << "\"!");
+
+  // Recompute the projected operators for the current problem and the MRI coefficients.
+  dim_V = n_V;
+  dim_Q = n_Q;
+  R.resize(n_Q, n_Q);
+  for (std::size_t j = 0; j < n_Q; j++)
+  {
+    for (std::size_t i = 0; i < n_Q; i++)
+    {
+      R(i, j) = std::complex<double>(Rr[j * n_Q + i], Ri[j * n_Q + i]);
+    }
+  }
+  z = std::move(samples);
+  ComputeMRI(R, q);
+  BlockTimer bt_prom(Timer::CONSTRUCT_PROM);
+  UpdatePROMOperators(0);
+}
+
 std::vector<std::complex<double>> RomOperator::ComputeEigenvalueEstimates() const
 {
   // XX TODO: Not yet implemented
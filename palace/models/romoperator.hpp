@@ -6,6 +6,7 @@
 
 #include <complex>
 #include <memory>
+#include <string>
 #include <vector>
 #include <Eigen/Dense>
 #include "linalg/ksp.hpp"
@@ -33,8 +34,12 @@ private:
   ComplexVector RHS1, RHS2, r;
   bool has_A2, has_RHS1, has_RHS2;
 
-  // HDM linear system solver and preconditioner.
+  // HDM linear system solver and preconditioner. Batched HDM solves optionally share a
+  // single preconditioner setup. The preconditioner matrix is kept alive until the next
+  // preconditioner update, since the solver only references it.
   std::unique_ptr<ComplexKspSolver> ksp;
+  std::unique_ptr<ComplexOperator> P;
+  bool batch_pc_reuse;
 
   // PROM matrices and vectors.
   Eigen::MatrixXcd Kr, Mr, Cr, Ar;
@@ -54,6 +59,12 @@ private:
   Eigen::VectorXcd q;
   std::vector<double> z;
 
+  // Helpers for HDM solves and updating the PROM operators and MRI after the basis has been
+  // extended from dimension dim_V0.
+  void SolveHDM(double omega, ComplexVector &u, bool update_pc);
+  void UpdatePROMOperators(std::size_t dim_V0);
+  void UpdateMRI(double omega, const ComplexVector &u);
+
 public:
   RomOperator(const IoData &iodata, SpaceOperator &spaceop, int max_size);
 
@@ -67,18 +78,47 @@ public:
   const auto &GetSamplePoints() const { return z; }
 
   // Assemble and solve the HDM at the specified frequency.
-  void SolveHDM(double omega, ComplexVector &u);
+  void SolveHDM(double omega, ComplexVector &u) { SolveHDM(omega, u, true); }
+
+  // Assemble and solve the HDM at a batch of frequencies.
+  void SolveHDM(const std::vector<double> &omega, std::vector<ComplexVector> &u);
 
   // Add the solution vector to the reduced-order basis and update the PROM.
   void UpdatePROM(double omega, const ComplexVector &u);
 
+  // Add a batch of solution vectors to the reduced-order basis using block
+  // orthogonalization and update the PROM.
+  void UpdatePROM(const std::vector<double> &omega, const std::vector<ComplexVector> &u);
+
   // Assemble and solve the PROM at the specified frequency, expanding the solution back
   // into the high-dimensional space.
   void SolvePROM(double omega, ComplexVector &u);
 
+  // Assemble and solve the PROM at the specified frequency without expanding the solution.
+  // The reduced-order solution is accessed using GetReducedSolution.
+  void SolvePROM(double omega);
+  const Eigen::VectorXcd &GetReducedSolution() const { return RHSr; }
+
+  // Project a linear functional f on the HDM true dofs onto the reduced-order basis, such
+  // that fᵀ u = frᵀ y for the PROM solution y with u = V y.
+  Eigen::VectorXd ProjectLinearForm(const Vector &f) const;
+
   // Compute the location(s) of the maximum error in the range of the previously sampled
-  // parameter points.
-  std::vector<double> FindMaxError(int N = 1) const;
+  // parameter points. Returns up to N distinct local maxima of the error estimate, sorted
+  // in order of decreasing error. The search range is optionally restricted to
+  // [z_min, z_max].
+  std::vector<double> FindMaxError(int N = 1, double z_min = -mfem::infinity(),
+                                   double z_max = mfem::infinity()) const;
+
+  // Write the reduced-order basis and MRI data to the given directory, with per-process
+  // binary files for the distributed basis vectors and a JSON index for the replicated
+  // data.
+  void SaveBasis(const std::string &dir) const;
+
+  // Load a reduced-order basis and MRI data previously written with SaveBasis, and
+  // recompute the PROM operators. The PROM must be empty. The loaded basis does not count
+  // against the storage allocated for new samples at construction.
+  void LoadBasis(const std::string &dir);
 
   // Compute eigenvalue estimates for the current PROM system.
   std::vector<std::complex<double>> ComputeEigenvalueEstimates() const;
@@ -24,7 +24,9 @@ using namespace std::complex_literals;
 SpaceOperator::SpaceOperator(const IoData &iodata,
                              const std::vector<std::unique_ptr<Mesh>> &mesh)
   : pc_mat_real(iodata.solver.linear.pc_mat_real),
-    pc_mat_shifted(iodata.solver.linear.pc_mat_shifted), print_hdr(true),
+    pc_mat_shifted(iodata.solver.linear.pc_mat_shifted),
+    pc_mat_single(iodata.solver.linear.mg_single_precision),
+    fused_system_mat(iodata.solver.fused_system_mat), print_hdr(true),
     print_prec_hdr(true), dbc_attr(SetUpBoundaryProperties(iodata, *mesh.back())),
     nd_fecs(fem::ConstructFECollections<mfem::ND_FECollection>(
         iodata.solver.order, mesh.back()->Dimension(), iodata.solver.linear.mg_max_levels,
@@ -199,7 +201,8 @@ void PrintHeader(const mfem::ParFiniteElementSpace &h1_fespace,
 void AddIntegrators(BilinearForm &a, const MaterialPropertyCoefficient *df,
                     const MaterialPropertyCoefficient *f,
                     const MaterialPropertyCoefficient *dfb,
-                    const MaterialPropertyCoefficient *fb, bool assemble_q_data = false)
+                    const MaterialPropertyCoefficient *fb, bool assemble_q_data = false,
+                    bool q_data_single = false)
 {
   if (df && !df->empty() && f && !f->empty())
   {
@@ -233,12 +236,13 @@ void AddIntegrators(BilinearForm &a, const MaterialPropertyCoefficient *df,
   }
   if (assemble_q_data)
   {
-    a.AssembleQuadratureData();
+    a.AssembleQuadratureData(q_data_single);
   }
 }
 
 void AddAuxIntegrators(BilinearForm &a, const MaterialPropertyCoefficient *f,
-                       const MaterialPropertyCoefficient *fb, bool assemble_q_data = false)
+                       const MaterialPropertyCoefficient *fb, bool assemble_q_data = false,
+                       bool q_data_single = false)
 {
   if (f && !f->empty())
   {
@@ -250,7 +254,7 @@ void AddAuxIntegrators(BilinearForm &a, const MaterialPropertyCoefficient *f,
   }
   if (assemble_q_data)
   {
-    a.AssembleQuadratureData();
+    a.AssembleQuadratureData(q_data_single);
   }
 }
 
@@ -271,20 +275,22 @@ auto AssembleOperators(const FiniteElementSpaceHierarchy &fespaces,
                        const MaterialPropertyCoefficient *f,
                        const MaterialPropertyCoefficient *dfb,
                        const MaterialPropertyCoefficient *fb, bool skip_zeros = false,
-                       bool assemble_q_data = false, std::size_t l0 = 0)
+                       bool assemble_q_data = false, bool q_data_single = false,
+                       std::size_t l0 = 0)
 {
   BilinearForm a(fespaces.GetFinestFESpace());
-  AddIntegrators(a, df, f, dfb, fb, assemble_q_data);
+  AddIntegrators(a, df, f, dfb, fb, assemble_q_data, q_data_single);
   return a.Assemble(fespaces, skip_zeros, l0);
 }
 
 auto AssembleAuxOperators(const AuxiliaryFiniteElementSpaceHierarchy &fespaces,
                           const MaterialPropertyCoefficient *f,
                           const MaterialPropertyCoefficient *fb, bool skip_zeros = false,
-                          bool assemble_q_data = false, std::size_t l0 = 0)
+                          bool assemble_q_data = false, bool q_data_single = false,
+                          std::size_t l0 = 0)
 {
   BilinearForm a(fespaces.GetFinestFESpace());
-  AddAuxIntegrators(a, f, fb, assemble_q_data);
+  AddAuxIntegrators(a, f, fb, assemble_q_data, q_data_single);
   return a.Assemble(fespaces, skip_zeros, l0);
 }
 
@@ -439,6 +445,33 @@ SpaceOperator::GetExtraSystemMatrix(double omega, Operator::DiagonalPolicy diag_
 namespace
 {
 
+// Sum operator which owns its first term, for adding an operator which is not owned to a
+// fused system matrix.
+class FusedSumOperator : public SumOperator
+{
+private:
+  std::unique_ptr<Operator> A;
+
+public:
+  FusedSumOperator(std::unique_ptr<Operator> &&A) : SumOperator(*A), A(std::move(A)) {}
+};
+
+std::unique_ptr<Operator> AddExtraOperator(std::unique_ptr<Operator> &&a,
+                                           const Operator *a2)
+{
+  if (!a2)
+  {
+    return std::move(a);
+  }
+  if (!a)
+  {
+    return std::make_unique<SumOperator>(*a2);
+  }
+  auto sum = std::make_unique<FusedSumOperator>(std::move(a));
+  sum->AddOperator(*a2, 1.0);
+  return sum;
+}
+
 auto BuildParSumOperator(int h, int w, double a0, double a1, double a2,
                          const ParOperator *K, const ParOperator *C, const ParOperator *M,
                          const ParOperator *A2, const FiniteElementSpace &fespace)
@@ -606,6 +639,87 @@ SpaceOperator::GetSystemMatrix(ScalarType a0, ScalarType a1, ScalarType a2,
   MFEM_VERIFY(height >= 0 && width >= 0,
               "At least one argument to GetSystemMatrix must not be empty!");
 
+  // With partial assembly, assemble the contributions from K, C, and M as a single operator
+  // using the fused curl-curl and mass integrators, with the coefficients a0, a1, and a2
+  // folded into the material property coefficients (the quadrature data for the geometry
+  // is shared). The extra matrix A2 is added as a separate term.
+  if (fused_system_mat &&
+      GetNDSpace().GetMaxElementOrder() >= BilinearForm::pa_order_threshold)
+  {
+    MaterialPropertyCoefficient dfr(mat_op.MaxCeedAttribute()),
+        dfi(mat_op.MaxCeedAttribute()), fr(mat_op.MaxCeedAttribute()),
+        fi(mat_op.MaxCeedAttribute()), fbr(mat_op.MaxCeedBdrAttribute()),
+        fbi(mat_op.MaxCeedBdrAttribute());
+    auto AddCoefficients = [&](double c0, double c1, double c2r, double c2i,
+                               MaterialPropertyCoefficient &df,
+                               MaterialPropertyCoefficient &f,
+                               MaterialPropertyCoefficient &fb)
+    {
+      if (PtAP_K && c0 != 0.0)
+      {
+        AddStiffnessCoefficients(c0, df, f);
+        AddStiffnessBdrCoefficients(c0, fb);
+      }
+      if (PtAP_C && c1 != 0.0)
+      {
+        AddDampingCoefficients(c1, f);
+        AddDampingBdrCoefficients(c1, fb);
+      }
+      if (PtAP_M && c2r != 0.0)
+      {
+        AddRealMassCoefficients(c2r, f);
+        AddRealMassBdrCoefficients(c2r, fb);
+      }
+      if (PtAP_M && c2i != 0.0)
+      {
+        AddImagMassCoefficients(c2i, f);
+      }
+    };
+    AddCoefficients(std::real(a0), std::real(a1), std::real(a2), -std::imag(a2), dfr, fr,
+                    fbr);
+    if constexpr (std::is_same<OperType, ComplexOperator>::value)
+    {
+      AddCoefficients(std::imag(a0), std::imag(a1), std::imag(a2), std::real(a2), dfi, fi,
+                      fbi);
+    }
+    int empty[2] = {(dfr.empty() && fr.empty() && fbr.empty()),
+                    (dfi.empty() && fi.empty() && fbi.empty())};
+    Mpi::GlobalMin(2, empty, GetComm());
+    if (!empty[0] || !empty[1])
+    {
+      constexpr bool skip_zeros = false;
+      std::unique_ptr<Operator> ar, ai;
+      if (!empty[0])
+      {
+        ar = AssembleOperator(GetNDSpace(), &dfr, &fr, nullptr, &fbr, skip_zeros);
+      }
+      if (!empty[1])
+      {
+        ai = AssembleOperator(GetNDSpace(), &dfi, &fi, nullptr, &fbi, skip_zeros);
+      }
+      if constexpr (std::is_same<OperType, ComplexOperator>::value)
+      {
+        ar = AddExtraOperator(std::move(ar),
+                              PtAP_A2 ? PtAP_A2->LocalOperator().Real() : nullptr);
+        ai = AddExtraOperator(std::move(ai),
+                              PtAP_A2 ? PtAP_A2->LocalOperator().Imag() : nullptr);
+        auto A = std::make_unique<ComplexParOperator>(std::move(ar), std::move(ai),
+                                                      GetNDSpace());
+        A->SetEssentialTrueDofs(nd_dbc_tdof_lists.back(),
+                                Operator::DiagonalPolicy::DIAG_ONE);
+        return A;
+      }
+      else
+      {
+        ar = AddExtraOperator(std::move(ar), PtAP_A2 ? &PtAP_A2->LocalOperator() : nullptr);
+        auto A = std::make_unique<ParOperator>(std::move(ar), GetNDSpace());
+        A->SetEssentialTrueDofs(nd_dbc_tdof_lists.back(),
+                                Operator::DiagonalPolicy::DIAG_ONE);
+        return A;
+      }
+    }
+  }
+
   auto A = BuildParSumOperator(height, width, a0, a1, a2, PtAP_K, PtAP_C, PtAP_M, PtAP_A2,
                                GetNDSpace());
   A->SetEssentialTrueDofs(nd_dbc_tdof_lists.back(), Operator::DiagonalPolicy::DIAG_ONE);
@@ -679,6 +793,18 @@ auto BuildLevelParOperator<ComplexOperator>(std::unique_ptr<Operator> &&br,
   return std::make_unique<ComplexParOperator>(std::move(br), std::move(bi), fespace);
 }
 
+bool HasAffineSimplexElements(const mfem::ParMesh &mesh)
+{
+  // Straight-sided triangles and tetrahedra store compressed geometry factor data once per
+  // element (see AssembleGeometryData in fem/mesh.cpp).
+  const auto *nodes = mesh.GetNodes();
+  bool affine = (!nodes || nodes->FESpace()->FEColl()->GetOrder() == 1) &&
+                (mesh.HasGeometry(mfem::Geometry::TRIANGLE) ||
+                 mesh.HasGeometry(mfem::Geometry::TETRAHEDRON));
+  Mpi::GlobalOr(1, &affine, mesh.GetComm());
+  return affine;
+}
+
 }  // namespace
 
 template <typename OperType>
@@ -701,7 +827,15 @@ std::unique_ptr<OperType> SpaceOperator::GetPreconditionerMatrix(double a0, doub
   const auto n_levels = GetNDSpaces().GetNumLevels();
   std::vector<std::unique_ptr<Operator>> br_vec(n_levels), bi_vec(n_levels),
       br_aux_vec(n_levels), bi_aux_vec(n_levels);
-  constexpr bool skip_zeros = false, assemble_q_data = false;
+  // The quadrature data for the preconditioner operators is optionally pre-assembled and
+  // stored in single precision, replacing the double precision data in place. This adds
+  // storage on each level, since the geometry factor data is shared with the other
+  // operators on the same mesh, but reduces the data read per element in each smoother
+  // application. It is skipped for meshes with compressed geometry factor data, for which
+  // quadrature point data would be much larger than the per-element geometry data.
+  constexpr bool skip_zeros = false;
+  const bool assemble_q_data = pc_mat_single && !HasAffineSimplexElements(GetMesh()),
+             q_data_single = assemble_q_data;
   if (std::is_same<OperType, ComplexOperator>::value && !pc_mat_real)
   {
     MaterialPropertyCoefficient dfr(mat_op.MaxCeedAttribute()),
@@ -723,16 +857,16 @@ std::unique_ptr<OperType> SpaceOperator::GetPreconditionerMatrix(double a0, doub
     if (!empty[0])
     {
       br_vec = AssembleOperators(GetNDSpaces(), &dfr, &fr, &dfbr, &fbr, skip_zeros,
-                                 assemble_q_data);
-      br_aux_vec =
-          AssembleAuxOperators(GetH1Spaces(), &fr, &fbr, skip_zeros, assemble_q_data);
+                                 assemble_q_data, q_data_single);
+      br_aux_vec = AssembleAuxOperators(GetH1Spaces(), &fr, &fbr, skip_zeros,
+                                        assemble_q_data, q_data_single);
     }
     if (!empty[1])
     {
       bi_vec = AssembleOperators(GetNDSpaces(), &dfi, &fi, &dfbi, &fbi, skip_zeros,
-                                 assemble_q_data);
-      bi_aux_vec =
-          AssembleAuxOperators(GetH1Spaces(), &fi, &fbi, skip_zeros, assemble_q_data);
+                                 assemble_q_data, q_data_single);
+      bi_aux_vec = AssembleAuxOperators(GetH1Spaces(), &fi, &fbi, skip_zeros,
+                                        assemble_q_data, q_data_single);
     }
   }
   else
@@ -752,9 +886,9 @@ std::unique_ptr<OperType> SpaceOperator::GetPreconditionerMatrix(double a0, doub
     if (!empty)
     {
       br_vec = AssembleOperators(GetNDSpaces(), &dfr, &fr, &dfbr, &fbr, skip_zeros,
-                                 assemble_q_data);
-      br_aux_vec =
-          AssembleAuxOperators(GetH1Spaces(), &fr, &fbr, skip_zeros, assemble_q_data);
+                                 assemble_q_data, q_data_single);
+      br_aux_vec = AssembleAuxOperators(GetH1Spaces(), &fr, &fbr, skip_zeros,
+                                        assemble_q_data, q_data_single);
     }
   }
 
@@ -931,6 +1065,35 @@ bool SpaceOperator::GetExcitationVector2(double omega, ComplexVector &RHS2)
   return nnz2;
 }
 
+bool SpaceOperator::GetLumpedPortExcitationVector(int idx, double omega,
+                                                  ComplexVector &RHS)
+{
+  // Frequency domain excitation vector for a single lumped port: RHS = iω RHS1.
+  RHS.SetSize(GetNDSpace().GetTrueVSize());
+  RHS.UseDevice(true);
+  RHS = 0.0;
+  SumVectorCoefficient fb(GetMesh().SpaceDimension());
+  lumped_port_op.AddExcitationBdrCoefficients(idx, fb);
+  bool nnz = AddExcitationVectorInternal(fb, RHS.Real());
+  RHS *= 1i * omega;
+  linalg::SetSubVector(RHS, nd_dbc_tdof_lists.back(), 0.0);
+  return nnz;
+}
+
+bool SpaceOperator::GetWavePortExcitationVector(int idx, double omega, ComplexVector &RHS)
+{
+  // Frequency domain excitation vector for a single wave port: RHS = RHS2(ω).
+  RHS.SetSize(GetNDSpace().GetTrueVSize());
+  RHS.UseDevice(true);
+  RHS = 0.0;
+  SumVectorCoefficient fbr(GetMesh().SpaceDimension()), fbi(GetMesh().SpaceDimension());
+  wave_port_op.AddExcitationBdrCoefficients(idx, omega, fbr, fbi);
+  bool nnzr = AddExcitationVectorInternal(fbr, RHS.Real());
+  bool nnzi = AddExcitationVectorInternal(fbi, RHS.Imag());
+  linalg::SetSubVector(RHS, nd_dbc_tdof_lists.back(), 0.0);
+  return nnzr || nnzi;
+}
+
 bool SpaceOperator::AddExcitationVector1Internal(Vector &RHS1)
 {
   // Assemble the time domain excitation -g'(t) J or frequency domain excitation -iω J.
@@ -941,20 +1104,7 @@ bool SpaceOperator::AddExcitationVector1Internal(Vector &RHS1)
   SumVectorCoefficient fb(GetMesh().SpaceDimension());
   lumped_port_op.AddExcitationBdrCoefficients(fb);
   surf_j_op.AddExcitationBdrCoefficients(fb);
-  int empty = (fb.empty());
-  Mpi::GlobalMin(1, &empty, GetComm());
-  if (empty)
-  {
-    return false;
-  }
-  mfem::LinearForm rhs1(&GetNDSpace().Get());
-  rhs1.AddBoundaryIntegrator(new VectorFEBoundaryLFIntegrator(fb));
-  rhs1.UseFastAssembly(false);
-  rhs1.UseDevice(false);
-  rhs1.Assemble();
-  rhs1.UseDevice(true);
-  GetNDSpace().GetProlongationMatrix()->AddMultTranspose(rhs1, RHS1);
-  return true;
+  return AddExcitationVectorInternal(fb, RHS1);
 }
 
 bool SpaceOperator::AddExcitationVector2Internal(double omega, ComplexVector &RHS2)
@@ -971,24 +1121,28 @@ bool SpaceOperator::AddExcitationVector2Internal(double omega, ComplexVector &RH
   {
     return false;
   }
+  AddExcitationVectorInternal(fbr, RHS2.Real());
+  AddExcitationVectorInternal(fbi, RHS2.Imag());
+  return true;
+}
+
+bool SpaceOperator::AddExcitationVectorInternal(SumVectorCoefficient &fb, Vector &RHS)
+{
+  // Assemble the boundary linear form for the given excitation coefficient and add it to
+  // the provided true dof vector.
+  int empty = (fb.empty());
+  Mpi::GlobalMin(1, &empty, GetComm());
+  if (empty)
   {
-    mfem::LinearForm rhs2(&GetNDSpace().Get());
-    rhs2.AddBoundaryIntegrator(new VectorFEBoundaryLFIntegrator(fbr));
-    rhs2.UseFastAssembly(false);
-    rhs2.UseDevice(false);
-    rhs2.Assemble();
-    rhs2.UseDevice(true);
-    GetNDSpace().GetProlongationMatrix()->AddMultTranspose(rhs2, RHS2.Real());
-  }
-  {
-    mfem::LinearForm rhs2(&GetNDSpace().Get());
-    rhs2.AddBoundaryIntegrator(new VectorFEBoundaryLFIntegrator(fbi));
-    rhs2.UseFastAssembly(false);
-    rhs2.UseDevice(false);
-    rhs2.Assemble();
-    rhs2.UseDevice(true);
-    GetNDSpace().GetProlongationMatrix()->AddMultTranspose(rhs2, RHS2.Imag());
+    return false;
   }
+  mfem::LinearForm rhs(&GetNDSpace().Get());
+  rhs.AddBoundaryIntegrator(new VectorFEBoundaryLFIntegrator(fb));
+  rhs.UseFastAssembly(false);
+  rhs.UseDevice(false);
+  rhs.Assemble();
+  rhs.UseDevice(true);
+  GetNDSpace().GetProlongationMatrix()->AddMultTranspose(rhs, RHS);
   return true;
 }
 
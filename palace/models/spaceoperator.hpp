@@ -31,8 +31,10 @@ class Mesh;
 class SpaceOperator
 {
 private:
-  const bool pc_mat_real;     // Use real-valued matrix for preconditioner
-  const bool pc_mat_shifted;  // Use shifted mass matrix for preconditioner
+  const bool pc_mat_real;       // Use real-valued matrix for preconditioner
+  const bool pc_mat_shifted;    // Use shifted mass matrix for preconditioner
+  const bool pc_mat_single;     // Use single precision quadrature data for preconditioner
+  const bool fused_system_mat;  // Assemble system matrix as a single fused operator
 
   // Helper variables for log file printing.
   bool print_hdr, print_prec_hdr;
@@ -84,6 +86,7 @@ private:
   // Helper functions for excitation vector assembly.
   bool AddExcitationVector1Internal(Vector &RHS);
   bool AddExcitationVector2Internal(double omega, ComplexVector &RHS);
+  bool AddExcitationVectorInternal(SumVectorCoefficient &fb, Vector &RHS);
 
 public:
   SpaceOperator(const IoData &iodata, const std::vector<std::unique_ptr<Mesh>> &mesh);
@@ -154,6 +157,10 @@ public:
   //                     A = a0 K + a1 C + a2 (Mr + i Mi) + A2 .
   // It is assumed that the inputs have been constructed using previous calls to
   // GetSystemMatrix() and the returned operator does not inherit ownership of any of them.
+  // With partial assembly, K, C, and M are not applied separately and instead a single
+  // operator is assembled with the weights a0, a1, and a2 applied to the material property
+  // coefficients, so that the operator application requires only a single pass over the
+  // mesh.
   template <typename OperType, typename ScalarType>
   std::unique_ptr<OperType>
   GetSystemMatrix(ScalarType a0, ScalarType a1, ScalarType a2, const OperType *K,
@@ -195,6 +202,12 @@ public:
   bool GetExcitationVector1(ComplexVector &RHS1);
   bool GetExcitationVector2(double omega, ComplexVector &RHS2);
 
+  // Assemble the frequency domain excitation vector for only the lumped or wave port with
+  // the given index, used for computing the scattering matrix one column at a time. The
+  // port must be marked for excitation.
+  bool GetLumpedPortExcitationVector(int idx, double omega, ComplexVector &RHS);
+  bool GetWavePortExcitationVector(int idx, double omega, ComplexVector &RHS);
+
   // Construct a constant or randomly initialized vector which satisfies the PEC essential
   // boundary conditions.
   void GetRandomInitialVector(ComplexVector &v);
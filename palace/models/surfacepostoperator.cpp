@@ -6,15 +6,106 @@
 #include <complex>
 #include "fem/gridfunction.hpp"
 #include "fem/integrator.hpp"
-#include "linalg/vector.hpp"
 #include "models/materialoperator.hpp"
 #include "utils/communication.hpp"
-#include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
 
 namespace palace
 {
 
+namespace
+{
+
+// Assemble the dual vectors of a linear surface functional over the given boundary
+// elements, for the local and face-neighbor degrees of freedom of a vector finite element
+// space. The functional is defined by weight vectors q1 and q2 multiplying the field
+// values in the neighboring elements at each quadrature point. Expects face-neighbor data
+// has already been exchanged for the finite element space.
+template <typename WeightFunction>
+void AssembleSurfaceDual(const mfem::ParFiniteElementSpace &fespace,
+                         const std::vector<mfem::Array<int>> &elem_lists,
+                         WeightFunction &&GetWeights, mfem::Vector &dual,
+                         mfem::Vector &dual_nbr)
+{
+  const auto &mesh = *fespace.GetParMesh();
+  const int sdim = mesh.SpaceDimension();
+  dual.SetSize(fespace.GetVSize());
+  dual_nbr.SetSize(fespace.GetFaceNbrVSize());
+  dual = 0.0;
+  dual_nbr = 0.0;
+  mfem::FaceElementTransformations FET;
+  mfem::IsoparametricTransformation T, T1, T2, TF;
+  mfem::DenseMatrix vshape;
+  mfem::Vector nor, C1(sdim), CF(sdim), q1(sdim), q2(sdim), elvec;
+  mfem::Array<int> vdofs;
+  mfem::DofTransformation dof_trans;
+  auto AddElementDual = [&](mfem::ElementTransformation &Te, int e, double w,
+                            const mfem::Vector &q)
+  {
+    // Elements with index beyond the number of local elements are face-neighbor elements
+    // across a shared face.
+    const bool nbr = (e >= mesh.GetNE());
+    const mfem::FiniteElement *fe;
+    if (nbr)
+    {
+      fe = fespace.GetFaceNbrFE(e - mesh.GetNE());
+      fespace.GetFaceNbrElementVDofs(e - mesh.GetNE(), vdofs, dof_trans);
+    }
+    else
+    {
+      fe = fespace.GetFE(e);
+      fespace.GetElementVDofs(e, vdofs, dof_trans);
+    }
+    vshape.SetSize(fe->GetDof(), sdim);
+    elvec.SetSize(fe->GetDof());
+    fe->CalcVShape(Te, vshape);
+    vshape.Mult(q, elvec);
+    elvec *= w;
+    if (dof_trans.GetDofTransformation())
+    {
+      dof_trans.TransformDual(elvec);
+    }
+    (nbr ? dual_nbr : dual).AddElementVector(vdofs, elvec);
+  };
+  for (const auto &elem_list : elem_lists)
+  {
+    for (const auto be : elem_list)
+    {
+      mesh.GetBdrElementTransformation(be, &T);
+      const int q_order = fem::DefaultIntegrationOrder::Get(T);
+      const mfem::IntegrationRule &ir = mfem::IntRules.Get(T.GetGeometryType(), q_order);
+      for (int j = 0; j < ir.GetNPoints(); j++)
+      {
+        const mfem::IntegrationPoint &ip = ir.IntPoint(j);
+        T.SetIntPoint(&ip);
+        BdrGridFunctionCoefficient::GetBdrElementNeighborTransformations(be, mesh, FET, T1,
+                                                                         T2, &ip);
+        if (j == 0)
+        {
+          // Vector pointing from the center of the boundary element into element 1, for
+          // orientation (see BdrGridFunctionCoefficient).
+          const int f = mesh.GetBdrElementFaceIndex(be);
+          mesh.GetFaceTransformation(f, &TF);
+          TF.Transform(mfem::Geometries.GetCenter(mesh.GetFaceGeometry(f)), CF);
+          FET.Elem1->Transform(mfem::Geometries.GetCenter(FET.Elem1->GetGeometryType()),
+                               C1);
+          C1 -= CF;
+        }
+        BdrGridFunctionCoefficient::GetNormal(T, nor);
+        GetWeights(FET, nor, C1, q1, q2);
+        const double w = ip.weight * T.Weight();
+        AddElementDual(*FET.Elem1, FET.Elem1No, w, q1);
+        if (FET.Elem2)
+        {
+          AddElementDual(*FET.Elem2, FET.Elem2No, w, q2);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
 SurfacePostOperator::InterfaceDielectricData::InterfaceDielectricData(
     const config::InterfaceDielectricData &data, const mfem::ParMesh &mesh)
   : ts(data.ts), tandelta(data.tandelta)
@@ -112,11 +203,21 @@ SurfacePostOperator::SurfaceChargeData::SurfaceChargeData(
   attr_list.Append(data.attributes.data(), data.attributes.size());
 }
 
-std::unique_ptr<mfem::Coefficient> SurfacePostOperator::SurfaceChargeData::GetCoefficient(
-    std::size_t i, const mfem::ParGridFunction &U, const MaterialOperator &mat_op) const
+void SurfacePostOperator::SurfaceChargeData::GetWeights(
+    const mfem::FaceElementTransformations &FET, const mfem::Vector &nor,
+    const mfem::Vector &C1, const MaterialOperator &mat_op, mfem::Vector &q1,
+    mfem::Vector &q2) const
 {
-  return std::make_unique<RestrictedCoefficient<BdrChargeCoefficient>>(attr_lists[i], U,
-                                                                       mat_op);
+  // Single-valued surface charge ρ_s = D ⋅ n = ε (E1 - E2) ⋅ n, oriented with the normal
+  // pointing into element 1 (see BdrChargeCoefficient).
+  const double s = (C1 * nor < 0.0) ? -1.0 : 1.0;
+  mat_op.GetPermittivityReal(FET.Elem1->Attribute).MultTranspose(nor, q1);
+  q1 *= s;
+  if (FET.Elem2)
+  {
+    mat_op.GetPermittivityReal(FET.Elem2->Attribute).MultTranspose(nor, q2);
+    q2 *= -s;
+  }
 }
 
 SurfacePostOperator::SurfaceFluxData::SurfaceFluxData(const config::InductanceData &data,
@@ -133,11 +234,20 @@ SurfacePostOperator::SurfaceFluxData::SurfaceFluxData(const config::InductanceDa
   attr_list.Append(data.attributes.data(), data.attributes.size());
 }
 
-std::unique_ptr<mfem::Coefficient> SurfacePostOperator::SurfaceFluxData::GetCoefficient(
-    std::size_t i, const mfem::ParGridFunction &U, const MaterialOperator &mat_op) const
+void SurfacePostOperator::SurfaceFluxData::GetWeights(
+    const mfem::FaceElementTransformations &FET, const mfem::Vector &nor,
+    const mfem::Vector &C1, const MaterialOperator &mat_op, mfem::Vector &q1,
+    mfem::Vector &q2) const
 {
-  return std::make_unique<RestrictedCoefficient<BdrFluxCoefficient>>(attr_lists[i], U,
-                                                                     mat_op, direction);
+  // Flux Φ_s = B ⋅ n, averaged over the neighboring elements for interior faces and
+  // oriented with the global direction (see BdrFluxCoefficient).
+  const double s = ((direction * nor < 0.0) ? -1.0 : 1.0) * (FET.Elem2 ? 0.5 : 1.0);
+  q1 = nor;
+  q1 *= s;
+  if (FET.Elem2)
+  {
+    q2 = q1;
+  }
 }
 
 SurfacePostOperator::SurfacePostOperator(const IoData &iodata,
@@ -220,6 +330,39 @@ SurfacePostOperator::SurfacePostOperator(const IoData &iodata,
       CheckAttributes(data);
     }
   }
+
+  // Compile the list of local boundary elements for each surface once, rather than looping
+  // over all boundary elements every time a surface integral is evaluated.
+  {
+    const auto &mesh = *h1_fespace.GetParMesh();
+    auto BuildElementLists = [&mesh](SurfaceData &data)
+    {
+      data.elem_lists.resize(data.attr_lists.size());
+      for (std::size_t i = 0; i < data.attr_lists.size(); i++)
+      {
+        data.elem_lists[i].DeleteAll();
+        for (int be = 0; be < mesh.GetNBE(); be++)
+        {
+          if (data.attr_lists[i].Find(mesh.GetBdrAttribute(be)) >= 0)
+          {
+            data.elem_lists[i].Append(be);
+          }
+        }
+      }
+    };
+    for (auto &[idx, data] : eps_surfs)
+    {
+      BuildElementLists(data);
+    }
+    for (auto &[idx, data] : charge_surfs)
+    {
+      BuildElementLists(data);
+    }
+    for (auto &[idx, data] : flux_surfs)
+    {
+      BuildElementLists(data);
+    }
+  }
 }
 
 double SurfacePostOperator::GetInterfaceLossTangent(int idx) const
@@ -236,11 +379,8 @@ double SurfacePostOperator::GetInterfaceElectricFieldEnergy(int idx,
   auto it = eps_surfs.find(idx);
   MFEM_VERIFY(it != eps_surfs.end(),
               "Unknown dielectric loss postprocessing surface index requested!");
-  double dot = GetLocalSurfaceIntegral(it->second, E.Real());
-  if (E.HasImag())
-  {
-    dot += GetLocalSurfaceIntegral(it->second, E.Imag());
-  }
+  const std::complex<double> sum = GetLocalSurfaceIntegral(it->second, E);
+  double dot = sum.real() + sum.imag();
   Mpi::GlobalSum(1, &dot, E.GetComm());
   return dot;
 }
@@ -250,11 +390,7 @@ double SurfacePostOperator::GetSurfaceElectricCharge(int idx, const GridFunction
   auto it = charge_surfs.find(idx);
   MFEM_VERIFY(it != charge_surfs.end(),
               "Unknown capacitance postprocessing surface index requested!");
-  std::complex<double> dot(GetLocalSurfaceIntegral(it->second, E.Real()), 0.0);
-  if (E.HasImag())
-  {
-    dot.imag(GetLocalSurfaceIntegral(it->second, E.Imag()));
-  }
+  std::complex<double> dot = GetLocalSurfaceIntegral(it->second, E);
   Mpi::GlobalSum(1, &dot, E.GetComm());
   return std::copysign(std::abs(dot), dot.real());
 }
@@ -264,36 +400,80 @@ double SurfacePostOperator::GetSurfaceMagneticFlux(int idx, const GridFunction &
   auto it = flux_surfs.find(idx);
   MFEM_VERIFY(it != flux_surfs.end(),
               "Unknown inductance postprocessing surface index requested!");
-  std::complex<double> dot(GetLocalSurfaceIntegral(it->second, B.Real()), 0.0);
-  if (B.HasImag())
-  {
-    dot.imag(GetLocalSurfaceIntegral(it->second, B.Imag()));
-  }
+  std::complex<double> dot = GetLocalSurfaceIntegral(it->second, B);
   Mpi::GlobalSum(1, &dot, B.GetComm());
   return std::copysign(std::abs(dot), dot.real());
 }
 
-double SurfacePostOperator::GetLocalSurfaceIntegral(const SurfaceData &data,
-                                                    const mfem::ParGridFunction &U) const
+std::complex<double>
+SurfacePostOperator::GetLocalSurfaceIntegral(const InterfaceDielectricData &data,
+                                             const GridFunction &U) const
 {
-  // Integrate the coefficient over the boundary attributes making up this surface index.
+  // Integrate the coefficients directly over the boundary elements making up this surface
+  // index. The interface dielectric integrand is quadratic in the field, so unlike the
+  // surface charge and flux it cannot be evaluated as a dot product with a precomputed
+  // dual vector.
   const auto &mesh = *U.ParFESpace()->GetParMesh();
-  SumCoefficient fb;
-  mfem::Array<int> attr_list;
+  mfem::IsoparametricTransformation T;
+  double sum_r = 0.0, sum_i = 0.0;
   for (std::size_t i = 0; i < data.attr_lists.size(); i++)
   {
-    fb.AddCoefficient(data.GetCoefficient(i, U, mat_op));
-    attr_list.Append(data.attr_lists[i]);
+    if (data.elem_lists[i].Size() == 0)
+    {
+      continue;
+    }
+    auto fr = data.GetCoefficient(i, U.Real(), mat_op);
+    auto fi = U.HasImag() ? data.GetCoefficient(i, U.Imag(), mat_op) : nullptr;
+    for (const auto be : data.elem_lists[i])
+    {
+      mesh.GetBdrElementTransformation(be, &T);
+      const int q_order = fem::DefaultIntegrationOrder::Get(T);
+      const mfem::IntegrationRule &ir = mfem::IntRules.Get(T.GetGeometryType(), q_order);
+      for (int j = 0; j < ir.GetNPoints(); j++)
+      {
+        const mfem::IntegrationPoint &ip = ir.IntPoint(j);
+        T.SetIntPoint(&ip);
+        const double w = ip.weight * T.Weight();
+        sum_r += w * fr->Eval(T, ip);
+        if (fi)
+        {
+          sum_i += w * fi->Eval(T, ip);
+        }
+      }
+    }
+  }
+  return {sum_r, sum_i};
+}
+
+std::complex<double>
+SurfacePostOperator::GetLocalSurfaceIntegral(const LinearSurfaceData &data,
+                                             const GridFunction &U) const
+{
+  // The surface charge and flux are linear functionals of the field, so their dual vectors
+  // are assembled once over the boundary elements of the surface and each evaluation is
+  // just a dot product. Contributions from neighboring elements across shared faces use the
+  // face-neighbor data of the field.
+  const auto &fespace = *U.ParFESpace();
+  if (data.dual_fespace != &fespace)
+  {
+    AssembleSurfaceDual(
+        fespace, data.elem_lists,
+        [this, &data](const mfem::FaceElementTransformations &FET, const mfem::Vector &nor,
+                      const mfem::Vector &C1, mfem::Vector &q1, mfem::Vector &q2)
+        { data.GetWeights(FET, nor, C1, mat_op, q1, q2); },
+        data.dual, data.dual_nbr);
+    data.dual_fespace = &fespace;
   }
-  int bdr_attr_max = mesh.bdr_attributes.Size() ? mesh.bdr_attributes.Max() : 0;
-  mfem::Array<int> attr_marker = mesh::AttrToMarker(bdr_attr_max, attr_list);
-  mfem::LinearForm s(&h1_fespace);
-  s.AddBoundaryIntegrator(new BoundaryLFIntegrator(fb), attr_marker);
-  s.UseFastAssembly(false);
-  s.UseDevice(false);
-  s.Assemble();
-  s.UseDevice(true);
-  return linalg::LocalSum(s);
+  auto Dot = [&data](const mfem::ParGridFunction &u)
+  {
+    double dot = data.dual * u;
+    if (data.dual_nbr.Size() > 0)
+    {
+      dot += data.dual_nbr * u.FaceNbrData();
+    }
+    return dot;
+  };
+  return {Dot(U.Real()), U.HasImag() ? Dot(U.Imag()) : 0.0};
 }
 
 }  // namespace palace
@@ -4,6 +4,7 @@
 #ifndef PALACE_MODELS_SURFACE_POST_OPERATOR_HPP
 #define PALACE_MODELS_SURFACE_POST_OPERATOR_HPP
 
+#include <complex>
 #include <map>
 #include <memory>
 #include <vector>
@@ -38,11 +39,11 @@ private:
   {
     std::vector<mfem::Array<int>> attr_lists;
 
-    virtual ~SurfaceData() = default;
+    // Local boundary elements for each attribute list, so that evaluating a surface
+    // integral only visits the elements which make up the surface.
+    std::vector<mfem::Array<int>> elem_lists;
 
-    virtual std::unique_ptr<mfem::Coefficient>
-    GetCoefficient(std::size_t i, const mfem::ParGridFunction &U,
-                   const MaterialOperator &mat_op) const = 0;
+    virtual ~SurfaceData() = default;
   };
   struct InterfaceDielectricData : public SurfaceData
   {
@@ -55,25 +56,42 @@ private:
 
     std::unique_ptr<mfem::Coefficient>
     GetCoefficient(std::size_t i, const mfem::ParGridFunction &U,
-                   const MaterialOperator &mat_op) const override;
+                   const MaterialOperator &mat_op) const;
+  };
+  struct LinearSurfaceData : public SurfaceData
+  {
+    // Dual vectors for the local and face-neighbor degrees of freedom of the field, such
+    // that the surface integral is a dot product with the field. They are assembled at the
+    // first evaluation for the finite element space of the field.
+    mutable mfem::Vector dual, dual_nbr;
+    mutable const mfem::ParFiniteElementSpace *dual_fespace = nullptr;
+
+    // Compute the vectors q1 and q2 such that the integrand at a point on the surface is
+    // q1 ⋅ U1 + q2 ⋅ U2, for field values U1 and U2 in the neighboring elements (q2 is
+    // unused when there is no second neighboring element). C1 points from the boundary
+    // element into element 1.
+    virtual void GetWeights(const mfem::FaceElementTransformations &FET,
+                            const mfem::Vector &nor, const mfem::Vector &C1,
+                            const MaterialOperator &mat_op, mfem::Vector &q1,
+                            mfem::Vector &q2) const = 0;
   };
-  struct SurfaceChargeData : public SurfaceData
+  struct SurfaceChargeData : public LinearSurfaceData
   {
     SurfaceChargeData(const config::CapacitanceData &data, const mfem::ParMesh &mesh);
 
-    std::unique_ptr<mfem::Coefficient>
-    GetCoefficient(std::size_t i, const mfem::ParGridFunction &U,
-                   const MaterialOperator &mat_op) const override;
+    void GetWeights(const mfem::FaceElementTransformations &FET, const mfem::Vector &nor,
+                    const mfem::Vector &C1, const MaterialOperator &mat_op,
+                    mfem::Vector &q1, mfem::Vector &q2) const override;
   };
-  struct SurfaceFluxData : public SurfaceData
+  struct SurfaceFluxData : public LinearSurfaceData
   {
     mfem::Vector direction;
 
     SurfaceFluxData(const config::InductanceData &data, const mfem::ParMesh &mesh);
 
-    std::unique_ptr<mfem::Coefficient>
-    GetCoefficient(std::size_t i, const mfem::ParGridFunction &U,
-                   const MaterialOperator &mat_op) const override;
+    void GetWeights(const mfem::FaceElementTransformations &FET, const mfem::Vector &nor,
+                    const mfem::Vector &C1, const MaterialOperator &mat_op,
+                    mfem::Vector &q1, mfem::Vector &q2) const override;
   };
   std::map<int, InterfaceDielectricData> eps_surfs;
   std::map<int, SurfaceChargeData> charge_surfs;
@@ -86,8 +104,15 @@ private:
   // owned).
   mfem::ParFiniteElementSpace &h1_fespace;
 
-  double GetLocalSurfaceIntegral(const SurfaceData &data,
-                                 const mfem::ParGridFunction &U) const;
+  // Integrate the quadratic interface dielectric coefficient for the real and imaginary
+  // parts of the given field together over the local boundary elements of the surface.
+  std::complex<double> GetLocalSurfaceIntegral(const InterfaceDielectricData &data,
+                                               const GridFunction &U) const;
+
+  // Evaluate a surface integral which is linear in the field for the real and imaginary
+  // parts of the given field, using the dual vectors for the surface.
+  std::complex<double> GetLocalSurfaceIntegral(const LinearSurfaceData &data,
+                                               const GridFunction &U) const;
 
 public:
   SurfacePostOperator(const IoData &iodata, const MaterialOperator &mat_op,
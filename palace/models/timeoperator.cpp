@@ -3,7 +3,11 @@
 
 #include "timeoperator.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <map>
+#include <utility>
 #include <vector>
 #include "linalg/iterative.hpp"
 #include "linalg/jacobi.hpp"
@@ -32,22 +36,38 @@ public:
   // returns g'(t).
   std::function<double(double)> &dJcoef;
 
-  // Internal objects for solution of linear systems during time stepping.
+  // Internal objects for solution of linear systems during time stepping. The linear
+  // solvers for the implicit system are stored for each set of integrator coefficients, so
+  // they can be reused when the time step size changes. When the cache is full, the least
+  // recently used solver is evicted.
+  struct ImplicitSolverData
+  {
+    std::unique_ptr<Operator> A, B;
+    std::unique_ptr<KspSolver> ksp;
+    std::size_t last_use = 0;
+  };
   double a0_, a1_;
-  std::unique_ptr<KspSolver> kspM, kspA;
-  std::unique_ptr<Operator> A, B;
+  std::unique_ptr<KspSolver> kspM;
+  std::map<std::pair<double, double>, ImplicitSolverData> kspA_cache;
+  std::size_t max_cache, num_use;
+  KspSolver *kspA;
+
+  // Linear solver statistics accumulated from implicit solvers evicted from the cache.
+  int evicted_mult, evicted_mult_it, evicted_pc_setup;
   mutable Vector RHS;
 
   // Bindings to SpaceOperator functions to get the system matrix and preconditioner, and
   // construct the linear solver.
-  std::function<void(double a0, double a1)> ConfigureLinearSolver;
+  std::function<void(double a0, double a1, ImplicitSolverData &data)>
+      ConfigureLinearSolver;
 
 public:
   TimeDependentCurlCurlOperator(const IoData &iodata, SpaceOperator &spaceop,
                                 std::function<double(double)> &djcoef, double t0,
                                 mfem::TimeDependentOperator::Type type)
     : mfem::SecondOrderTimeDependentOperator(spaceop.GetNDSpace().GetTrueVSize(), t0, type),
-      comm(spaceop.GetComm()), dJcoef(djcoef)
+      comm(spaceop.GetComm()), dJcoef(djcoef), num_use(0), kspA(nullptr),
+      evicted_mult(0), evicted_mult_it(0), evicted_pc_setup(0)
   {
     // Construct the system matrices defining the linear operator. PEC boundaries are
     // handled simply by setting diagonal entries of the mass matrix for the corresponding
@@ -78,21 +98,28 @@ public:
       // For explicit schemes, recommended to just use cheaper preconditioners. Otherwise,
       // use AMS or a direct solver. The system matrix is formed as a sequence of matrix
       // vector products, and is only assembled for preconditioning.
-      ConfigureLinearSolver = [this, &iodata, &spaceop](double a0, double a1)
+      ConfigureLinearSolver =
+          [this, &iodata, &spaceop](double a0, double a1, ImplicitSolverData &data)
       {
         // Configure the system matrix and also the matrix (matrices) from which the
         // preconditioner will be constructed.
-        A = spaceop.GetSystemMatrix(a0, a1, 1.0, K.get(), C.get(), M.get());
-        B = spaceop.GetPreconditionerMatrix<Operator>(a0, a1, 1.0, 0.0);
+        data.A = spaceop.GetSystemMatrix(a0, a1, 1.0, K.get(), C.get(), M.get());
+        data.B = spaceop.GetPreconditionerMatrix<Operator>(a0, a1, 1.0, 0.0);
 
         // Configure the solver.
-        if (!kspA)
+        if (!data.ksp)
         {
-          kspA = std::make_unique<KspSolver>(iodata, spaceop.GetNDSpaces(),
-                                             &spaceop.GetH1Spaces());
+          data.ksp = std::make_unique<KspSolver>(iodata, spaceop.GetNDSpaces(),
+                                                 &spaceop.GetH1Spaces());
         }
-        kspA->SetOperators(*A, *B);
+        data.ksp->SetOperators(*data.A, *data.B);
       };
+
+      // With adaptive time stepping, a linear solver is stored for each allowed time step
+      // size.
+      max_cache = (iodata.solver.transient.adaptive_tol > 0.0)
+                      ? iodata.solver.transient.adaptive_max_levels + 1
+                      : 1;
     }
   }
 
@@ -128,8 +155,29 @@ public:
     if (!kspA || a0 != a0_ || a1 != a1_)
     {
       // Configure the linear solver, including the system matrix and also the matrix
-      // (matrices) from which the preconditioner will be constructed.
-      ConfigureLinearSolver(a0, a1);
+      // (matrices) from which the preconditioner will be constructed. If a solver has
+      // already been constructed for these coefficients, reuse it.
+      auto it = kspA_cache.find({a0, a1});
+      if (it == kspA_cache.end())
+      {
+        if (kspA_cache.size() >= max_cache)
+        {
+          auto lru = std::min_element(kspA_cache.begin(), kspA_cache.end(),
+                                      [](const auto &l, const auto &r)
+                                      { return l.second.last_use < r.second.last_use; });
+          if (lru->second.ksp)
+          {
+            evicted_mult += lru->second.ksp->NumTotalMult();
+            evicted_mult_it += lru->second.ksp->NumTotalMultIterations();
+            evicted_pc_setup += lru->second.ksp->NumTotalPreconditionerSetup();
+          }
+          kspA_cache.erase(lru);
+        }
+        it = kspA_cache.emplace(std::make_pair(a0, a1), ImplicitSolverData()).first;
+        ConfigureLinearSolver(a0, a1, it->second);
+      }
+      it->second.last_use = ++num_use;
+      kspA = it->second.ksp.get();
       a0_ = a0;
       a1_ = a1;
       k = 0.0;
@@ -144,6 +192,10 @@ public:
 
 TimeOperator::TimeOperator(const IoData &iodata, SpaceOperator &spaceop,
                            std::function<double(double)> &djcoef)
+  : comm(spaceop.GetComm()), adapt_tol(iodata.solver.transient.adaptive_tol),
+    dt_min(iodata.solver.transient.delta_t), t_max(iodata.solver.transient.max_t),
+    max_level(iodata.solver.transient.adaptive_max_levels), err_coef(0.0), dt_prev(0.0),
+    E_max(0.0)
 {
   // Construct discrete curl matrix for B-field time integration.
   Curl = &spaceop.GetCurlMatrix();
@@ -157,6 +209,19 @@ TimeOperator::TimeOperator(const IoData &iodata, SpaceOperator &spaceop,
   dE.UseDevice(true);
   En.UseDevice(true);
   B.UseDevice(true);
+  if (adapt_tol > 0.0)
+  {
+    E0.SetSize(Curl->Width());
+    dE0.SetSize(Curl->Width());
+    ddE0.SetSize(Curl->Width());
+    dEp.SetSize(Curl->Width());
+    Ew.SetSize(Curl->Width());
+    E0.UseDevice(true);
+    dE0.UseDevice(true);
+    ddE0.UseDevice(true);
+    dEp.UseDevice(true);
+    Ew.UseDevice(true);
+  }
 
   // Create ODE solver for 2nd-order IVP.
   mfem::TimeDependentOperator::Type type = mfem::TimeDependentOperator::EXPLICIT;
@@ -168,6 +233,12 @@ TimeOperator::TimeOperator(const IoData &iodata, SpaceOperator &spaceop,
         constexpr double rho_inf = 1.0;
         ode = std::make_unique<mfem::GeneralizedAlpha2Solver>(rho_inf);
         type = mfem::TimeDependentOperator::IMPLICIT;
+
+        // Equivalent Newmark parameter β for the local error estimate.
+        const double alpha_m = (2.0 - rho_inf) / (1.0 + rho_inf);
+        const double alpha_f = 1.0 / (1.0 + rho_inf);
+        const double beta = 0.25 * std::pow(1.0 + alpha_m - alpha_f, 2);
+        err_coef = std::abs(beta - 1.0 / 6.0);
       }
       break;
     case config::TransientSolverData::Type::NEWMARK:
@@ -175,6 +246,7 @@ TimeOperator::TimeOperator(const IoData &iodata, SpaceOperator &spaceop,
         constexpr double beta = 0.25, gamma = 0.5;
         ode = std::make_unique<mfem::NewmarkSolver>(beta, gamma);
         type = mfem::TimeDependentOperator::IMPLICIT;
+        err_coef = std::abs(beta - 1.0 / 6.0);
       }
       break;
     case config::TransientSolverData::Type::CENTRAL_DIFF:
@@ -185,16 +257,33 @@ TimeOperator::TimeOperator(const IoData &iodata, SpaceOperator &spaceop,
       break;
   }
 
+  MFEM_VERIFY(adapt_tol == 0.0 || type == mfem::TimeDependentOperator::IMPLICIT,
+              "Adaptive time stepping is only available for implicit time integration "
+              "schemes!");
+
   // Set up time-dependent operator for 2nd-order curl-curl equation for E.
   op = std::make_unique<TimeDependentCurlCurlOperator>(iodata, spaceop, djcoef, 0.0, type);
 }
 
-const KspSolver &TimeOperator::GetLinearSolver() const
+TimeOperator::LinearSolverStats TimeOperator::GetLinearSolverStats() const
 {
   const auto &curlcurl = dynamic_cast<const TimeDependentCurlCurlOperator &>(*op);
   MFEM_VERIFY(curlcurl.kspA,
               "No linear solver for time-depdendent operator has been constructed!\n");
-  return *curlcurl.kspA;
+  LinearSolverStats stats;
+  stats.ksp_mult = curlcurl.evicted_mult;
+  stats.ksp_mult_it = curlcurl.evicted_mult_it;
+  stats.pc_setup = curlcurl.evicted_pc_setup;
+  for (const auto &[coeffs, data] : curlcurl.kspA_cache)
+  {
+    if (data.ksp)
+    {
+      stats.ksp_mult += data.ksp->NumTotalMult();
+      stats.ksp_mult_it += data.ksp->NumTotalMultIterations();
+      stats.pc_setup += data.ksp->NumTotalPreconditionerSetup();
+    }
+  }
+  return stats;
 }
 
 double TimeOperator::GetMaxTimeStep() const
@@ -230,17 +319,115 @@ void TimeOperator::Init()
   dE = 0.0;
   B = 0.0;
   ode->Init(*op);
+  dt_prev = 0.0;
+  E_max = 0.0;
+}
+
+double TimeOperator::GetTimeStep(double t, double dt) const
+{
+  if (adapt_tol == 0.0)
+  {
+    return dt;
+  }
+  int level =
+      std::clamp(static_cast<int>(std::lround(std::log2(dt / dt_min))), 0, max_level);
+  while (level > 0 && t + std::ldexp(dt_min, level) > t_max + 0.5 * dt_min)
+  {
+    level--;
+  }
+  return std::ldexp(dt_min, level);
 }
 
 void TimeOperator::Step(double &t, double &dt)
 {
-  // Single time step for E-field.
-  En = E;
-  ode->Step(E, dE, t, dt);
+  if (adapt_tol == 0.0)
+  {
+    // Single time step for E-field.
+    En = E;
+    ode->Step(E, dE, t, dt);
+
+    // Trapezoidal integration for B-field: dB/dt = -∇ x E.
+    En += E;
+    Curl->AddMult(En, B, -0.5 * dt);
+    return;
+  }
+
+  // Select the time step level for a given step size, based on the estimated local error
+  // of the step taken with step size h (third-order error estimate, with safety factor).
+  auto GetLevel = [this](double h, double err)
+  {
+    constexpr double safety = 0.9;
+    const double h_new = (err > 0.0) ? safety * h * std::cbrt(adapt_tol / err) : 2.0 * h;
+    return std::clamp(static_cast<int>(std::floor(std::log2(h_new / dt_min))), 0,
+                      max_level);
+  };
 
-  // Trapezoidal integration for B-field: dB/dt = -∇ x E.
-  En += E;
-  Curl->AddMult(En, B, -0.5 * dt);
+  // Adaptive time step for E-field, repeated with a smaller step size as long as the
+  // estimated local error is above the tolerance.
+  int level = static_cast<int>(std::lround(std::log2(GetTimeStep(t, dt) / dt_min)));
+  E0 = E;
+  dE0 = dE;
+  const bool save_state = (ode->GetStateSize() > 0);
+  if (save_state)
+  {
+    ode->GetStateVector(0, ddE0);
+  }
+  while (true)
+  {
+    double tk = t, dtk = std::ldexp(dt_min, level);
+    ode->Step(E, dE, tk, dtk);
+
+    // Estimate the local error as e ≈ |β - 1/6| Δt² (a_{n+1} - a_n) (Zienkiewicz and Xie,
+    // 1991), where the change in acceleration is approximated using the second divided
+    // difference of the E-field time derivative over the current and previous steps. The
+    // error is measured relative to the maximum E-field norm.
+    double err = 0.0;
+    const double E_norm = std::max(E_max, linalg::Norml2(comm, E));
+    if (dt_prev > 0.0 && E_norm > 0.0)
+    {
+      Ew = dEp;
+      Ew *= 1.0 / dt_prev;
+      linalg::AXPBYPCZ(1.0 / dtk, dE, -1.0 / dtk - 1.0 / dt_prev, dE0, 1.0, Ew);
+      err = err_coef * 2.0 * std::pow(dtk, 3) / (dtk + dt_prev) *
+            linalg::Norml2(comm, Ew) / E_norm;
+    }
+    if (err > adapt_tol && level > 0)
+    {
+      // Reject the step and restore the saved integrator state. Before the first step, the
+      // integrator has no state yet and is simply reinitialized.
+      const int level_new = std::min(level - 1, GetLevel(dtk, err));
+      Mpi::Print(" Rejected time step (estimated error = {:.3e} > {:.3e}), reducing step "
+                 "size by a factor of {:d}\n",
+                 err, adapt_tol, 1 << (level - level_new));
+      E = E0;
+      dE = dE0;
+      if (save_state)
+      {
+        ode->SetStateVector(0, ddE0);
+      }
+      else
+      {
+        ode->Init(*op);
+      }
+      level = level_new;
+      continue;
+    }
+
+    // Trapezoidal integration for B-field: dB/dt = -∇ x E.
+    En = E0;
+    En += E;
+    Curl->AddMult(En, B, -0.5 * dtk);
+
+    // Accept the step and suggest the next step size, increasing by at most a factor of
+    // two. The step size is not increased until the field is nonzero.
+    dEp = dE0;
+    dt_prev = dtk;
+    E_max = E_norm;
+    t = tk;
+    dt = (E_max > 0.0) ? std::ldexp(dt_min, std::min(GetLevel(dtk, err), level + 1))
+                       : dtk;
+    return;
+  }
 }
 
 }  // namespace palace
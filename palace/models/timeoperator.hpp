@@ -23,9 +23,25 @@ class SpaceOperator;
 class TimeOperator
 {
 private:
+  // MPI communicator.
+  MPI_Comm comm;
+
   // Solution vector storage.
   Vector E, dE, En, B;
 
+  // Parameters for adaptive time step selection: relative local error tolerance (0 for
+  // fixed time steps), minimum (initial) time step, final time, and maximum number of time
+  // step doublings.
+  double adapt_tol, dt_min, t_max;
+  int max_level;
+
+  // Data for local error estimation: error constant of the integration scheme, step size of
+  // the previous accepted step, maximum field norm, and saved solution, time derivative,
+  // and integrator state (second time derivative) at the beginning of the step and end of
+  // the previous step.
+  double err_coef, dt_prev, E_max;
+  Vector E0, dE0, ddE0, dEp, Ew;
+
   // Time integrator for the curl-curl E-field formulation.
   std::unique_ptr<mfem::SecondOrderODESolver> ode;
 
@@ -44,12 +60,23 @@ public:
   const Vector &GetEdot() const { return dE; }
   const Vector &GetB() const { return B; }
 
-  // Return the linear solver associated with the implicit or explicit time integrator.
-  const KspSolver &GetLinearSolver() const;
+  // Linear solver statistics for the implicit or explicit time integrator, summed over the
+  // linear solvers for all time step sizes (including those evicted from the cache).
+  struct LinearSolverStats
+  {
+    int ksp_mult = 0, ksp_mult_it = 0, pc_setup = 0;
+    int NumTotalMult() const { return ksp_mult; }
+    int NumTotalMultIterations() const { return ksp_mult_it; }
+    int NumTotalPreconditionerSetup() const { return pc_setup; }
+  };
+  LinearSolverStats GetLinearSolverStats() const;
 
   // Return if the time integration scheme explicit or implicit.
   bool isExplicit() const { return op->isExplicit(); }
 
+  // Return if the time step size is selected adaptively.
+  bool isAdaptive() const { return adapt_tol > 0.0; }
+
   // Estimate the maximum stable time step based on the maximum eigenvalue of the
   // undamped system matrix M⁻¹ K.
   double GetMaxTimeStep() const;
@@ -57,7 +84,14 @@ public:
   // Initialize time integrators and set 0 initial conditions.
   void Init();
 
-  // Perform time step from t -> t + dt.
+  // Return the time step size which will be taken from time t given the requested step dt.
+  // For adaptive time stepping, the step is restricted to dt_min 2ᵏ, k = 0, 1, ..., and
+  // limited to not step past the final time.
+  double GetTimeStep(double t, double dt) const;
+
+  // Perform time step from t -> t + dt. For adaptive time stepping, the step may be
+  // rejected and repeated with a smaller step size, and on output t is the new time and dt
+  // is the suggested size for the next time step.
   void Step(double &t, double &dt);
 };
 
@@ -3,6 +3,7 @@
 
 #include "waveportoperator.hpp"
 
+#include <algorithm>
 #include <tuple>
 #include "fem/bilinearform.hpp"
 #include "fem/coefficient.hpp"
@@ -523,8 +524,10 @@ WavePortData::WavePortData(const config::WavePortData &data,
   d_offset = data.d_offset;
   excitation = data.excitation;
   active = data.active;
+  interp_tol = data.interp_tol;
   kn0 = 0.0;
   omega0 = 0.0;
+  lambda = 0.0;
 
   // Construct the SubMesh.
   MFEM_VERIFY(!data.attributes.empty(), "Wave port boundary found with no attributes!");
@@ -834,56 +837,140 @@ WavePortData::~WavePortData()
 
 void WavePortData::Initialize(double omega)
 {
-  if (omega == omega0)
+  if (omega == omega0 || InterpolateMode(omega))
   {
     return;
   }
+  AssembleModeProblem(omega);
+  SolveModeProblem();
+  UpdateMode(omega);
+}
 
-  // Construct matrices and solve the generalized eigenvalue problem for the desired wave
-  // port mode. B uses the non-owning constructor since the matrices Br, Bi are not
-  // functions of frequency (constructed once for all).
-  std::unique_ptr<ComplexOperator> A;
-  const double sigma = -omega * omega * mu_eps_min;
+bool WavePortData::InterpolateMode(double omega)
+{
+  // Interpolate the mode between the nearest exact solves on either side of the requested
+  // frequency. The difference between this linear interpolant and the quadratic interpolant
+  // of kₙ which also uses the next nearest solve is the error estimate. Outside of the
+  // range of the exact solves, the mode is never extrapolated. The mode fields are
+  // interpolated linearly and renormalized, which is consistent since the cached modes all
+  // use the same normalization.
+  if (interp_tol <= 0.0 || mode_cache.size() < 3)
+  {
+    return false;
+  }
+  const ModeData *p0 = nullptr, *p1 = nullptr, *p2 = nullptr;
+  for (const auto &data : mode_cache)
+  {
+    if (data.omega <= omega && (!p0 || data.omega > p0->omega))
+    {
+      p0 = &data;
+    }
+    else if (data.omega > omega && (!p1 || data.omega < p1->omega))
+    {
+      p1 = &data;
+    }
+  }
+  if (!p0 || !p1)
+  {
+    return false;
+  }
+  for (const auto &data : mode_cache)
+  {
+    if (&data != p0 && &data != p1 &&
+        (!p2 || std::abs(omega - data.omega) < std::abs(omega - p2->omega)))
+    {
+      p2 = &data;
+    }
+  }
+  const auto &d0 = *p0, &d1 = *p1, &d2 = *p2;
+  const double t = (omega - d0.omega) / (d1.omega - d0.omega);
+  const double l0 = (omega - d1.omega) * (omega - d2.omega) /
+                    ((d0.omega - d1.omega) * (d0.omega - d2.omega));
+  const double l1 = (omega - d0.omega) * (omega - d2.omega) /
+                    ((d1.omega - d0.omega) * (d1.omega - d2.omega));
+  const double l2 = (omega - d0.omega) * (omega - d1.omega) /
+                    ((d2.omega - d0.omega) * (d2.omega - d1.omega));
+  const std::complex<double> kn_lin = (1.0 - t) * d0.kn + t * d1.kn;
+  const std::complex<double> kn_quad = l0 * d0.kn + l1 * d1.kn + l2 * d2.kn;
+  if (std::abs(kn_quad - kn_lin) > interp_tol * std::abs(kn_quad))
+  {
+    return false;
+  }
+  kn0 = kn_quad;
+  omega0 = omega;
+
+  // Interpolate the mode fields and normalize.
   {
-    auto [Attr, Atti] = GetAtt(mat_op, *port_nd_fespace, port_normal, omega, sigma);
-    auto [Ar, Ai] =
-        GetSystemMatrixA(Attr.get(), Atti.get(), Atnr.get(), Atni.get(), Antr.get(),
-                         Anti.get(), Annr.get(), Anni.get(), port_dbc_tdof_list);
-    A = std::make_unique<ComplexWrapperOperator>(std::move(Ar), std::move(Ai));
+    ComplexVector E0t(d0.E0t), E0n(d0.E0n);
+    E0t.AXPBY(t, d1.E0t, 1.0 - t);
+    E0n.AXPBY(t, d1.E0n, 1.0 - t);
+    port_E0t->Real() = E0t.Real();
+    port_E0t->Imag() = E0t.Imag();
+    port_E0n->Real() = E0n.Real();
+    port_E0n->Imag() = E0n.Imag();
   }
+  UpdateModeNormalization();
+  return true;
+}
+
+bool WavePortData::NeedsModeAnchor(double omega) const
+{
+  return interp_tol > 0.0 &&
+         std::none_of(mode_cache.begin(), mode_cache.end(),
+                      [omega](const ModeData &data) { return data.omega > omega; });
+}
 
+void WavePortData::AssembleModeProblem(double omega)
+{
+  // Construct matrices for the generalized eigenvalue problem for the desired wave port
+  // mode. B uses the non-owning constructor since the matrices Br, Bi are not functions of
+  // frequency (constructed once for all).
+  const double sigma = -omega * omega * mu_eps_min;
+  auto [Attr, Atti] = GetAtt(mat_op, *port_nd_fespace, port_normal, omega, sigma);
+  auto [Ar, Ai] = GetSystemMatrixA(Attr.get(), Atti.get(), Atnr.get(), Atni.get(),
+                                   Antr.get(), Anti.get(), Annr.get(), Anni.get(),
+                                   port_dbc_tdof_list);
+  A = std::make_unique<ComplexWrapperOperator>(std::move(Ar), std::move(Ai));
+}
+
+void WavePortData::SolveModeProblem()
+{
   // Configure and solve the (inverse) eigenvalue problem for the desired boundary mode.
   // Linear solves are preconditioned with the real part of the system matrix (ignore loss
-  // tangent).
-  std::complex<double> lambda;
-  if (port_comm != MPI_COMM_NULL)
+  // tangent). The computed mode is used as the initial space for the next solve.
+  if (port_comm == MPI_COMM_NULL)
   {
-    ComplexWrapperOperator P(A->Real(), nullptr);  // Non-owning constructor
-    ksp->SetOperators(*A, P);
-    eigen->SetOperators(*B0, *A, EigenvalueSolver::ScaleType::NONE);
-    eigen->SetInitialSpace(v0);
-    int num_conv = eigen->Solve();
-    MFEM_VERIFY(num_conv >= mode_idx, "Wave port eigensolver did not converge!");
-    lambda = eigen->GetEigenvalue(mode_idx - 1);
-    // Mpi::Print(port_comm, " ... Wave port eigensolver error = {} (bkwd), {} (abs)\n",
-    //            eigen->GetError(mode_idx - 1, EigenvalueSolver::ErrorType::BACKWARD),
-    //            eigen->GetError(mode_idx - 1, EigenvalueSolver::ErrorType::ABSOLUTE));
+    return;
   }
-  Mpi::Broadcast(1, &lambda, port_root, port_mesh->GetComm());
+  MFEM_VERIFY(A, "Wave port system matrix must be assembled before solving for mode!");
+  ComplexWrapperOperator P(A->Real(), nullptr);  // Non-owning constructor
+  ksp->SetOperators(*A, P);
+  eigen->SetOperators(*B0, *A, EigenvalueSolver::ScaleType::NONE);
+  eigen->SetInitialSpace(v0);
+  int num_conv = eigen->Solve();
+  MFEM_VERIFY(num_conv >= mode_idx, "Wave port eigensolver did not converge!");
+  lambda = eigen->GetEigenvalue(mode_idx - 1);
+  // Mpi::Print(port_comm, " ... Wave port eigensolver error = {} (bkwd), {} (abs)\n",
+  //            eigen->GetError(mode_idx - 1, EigenvalueSolver::ErrorType::BACKWARD),
+  //            eigen->GetError(mode_idx - 1, EigenvalueSolver::ErrorType::ABSOLUTE));
+  eigen->GetEigenvector(mode_idx - 1, e0);
+  v0 = e0;
+}
 
+void WavePortData::UpdateMode(double omega)
+{
   // Extract the eigenmode solution and postprocess. The extracted eigenvalue is λ =
   // 1 / (-kₙ² - σ).
+  const double sigma = -omega * omega * mu_eps_min;
+  Mpi::Broadcast(1, &lambda, port_root, port_mesh->GetComm());
   kn0 = std::sqrt(-sigma - 1.0 / lambda);
   omega0 = omega;
+  A.reset();
 
   // Separate the computed field out into eₜ and eₙ and and transform back to true
   // electric field variables: Eₜ = eₜ and Eₙ = eₙ / ikₙ.
   {
-    if (port_comm != MPI_COMM_NULL)
-    {
-      eigen->GetEigenvector(mode_idx - 1, e0);
-    }
-    else
+    if (port_comm == MPI_COMM_NULL)
     {
       MFEM_ASSERT(e0.Size() == 0,
                   "Unexpected non-empty port FE space in wave port boundary mode solve!");
@@ -906,30 +993,41 @@ void WavePortData::Initialize(double omega)
     port_E0n->Real().SetFromTrueDofs(e0nr);
     port_E0n->Imag().SetFromTrueDofs(e0ni);
   }
+  UpdateModeNormalization();
 
+  // Store the normalized mode for interpolation at later frequencies.
+  if (interp_tol > 0.0 && std::none_of(mode_cache.begin(), mode_cache.end(),
+                                        [omega](const ModeData &data)
+                                        { return data.omega == omega; }))
+  {
+    mode_cache.push_back({omega, kn0, ComplexVector(port_E0t->Real(), port_E0t->Imag()),
+                          ComplexVector(port_E0n->Real(), port_E0n->Imag())});
+  }
+}
+
+void WavePortData::UpdateModeNormalization()
+{
   // Configure the linear forms for computing S-parameters (projection of the field onto the
   // port mode). Normalize the mode for a chosen polarization direction and unit power,
   // |E x H⋆| ⋅ n, integrated over the port surface (+n is the direction of propagation).
-  {
-    const auto &port_submesh = static_cast<const mfem::ParSubMesh &>(port_mesh->Get());
-    BdrSubmeshHVectorCoefficient<ValueType::REAL> port_nxH0r_func(
-        *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
-    BdrSubmeshHVectorCoefficient<ValueType::IMAG> port_nxH0i_func(
-        *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
-    port_sr = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
-    port_si = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
-    port_sr->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0r_func));
-    port_si->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0i_func));
-    port_sr->UseFastAssembly(false);
-    port_si->UseFastAssembly(false);
-    port_sr->UseDevice(false);
-    port_si->UseDevice(false);
-    port_sr->Assemble();
-    port_si->Assemble();
-    port_sr->UseDevice(true);
-    port_si->UseDevice(true);
-    Normalize(*port_S0t, *port_E0t, *port_E0n, *port_sr, *port_si);
-  }
+  const auto &port_submesh = static_cast<const mfem::ParSubMesh &>(port_mesh->Get());
+  BdrSubmeshHVectorCoefficient<ValueType::REAL> port_nxH0r_func(
+      *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
+  BdrSubmeshHVectorCoefficient<ValueType::IMAG> port_nxH0i_func(
+      *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
+  port_sr = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
+  port_si = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
+  port_sr->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0r_func));
+  port_si->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0i_func));
+  port_sr->UseFastAssembly(false);
+  port_si->UseFastAssembly(false);
+  port_sr->UseDevice(false);
+  port_si->UseDevice(false);
+  port_sr->Assemble();
+  port_si->Assemble();
+  port_sr->UseDevice(true);
+  port_si->UseDevice(true);
+  Normalize(*port_S0t, *port_E0t, *port_E0n, *port_sr, *port_si);
 }
 
 std::unique_ptr<mfem::VectorCoefficient>
@@ -1027,7 +1125,8 @@ WavePortOperator::WavePortOperator(const IoData &iodata, const MaterialOperator
                                    mfem::ParFiniteElementSpace &h1_fespace)
   : suppress_output(false),
     fc(iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, 1.0)),
-    kc(1.0 / iodata.DimensionalizeValue(IoData::ValueType::LENGTH, 1.0))
+    kc(1.0 / iodata.DimensionalizeValue(IoData::ValueType::LENGTH, 1.0)),
+    anchor_delta_omega(0.0), anchor_omega_max(0.0)
 {
   // Set up wave port boundary conditions.
   MFEM_VERIFY(nd_fespace.GetParMesh() == h1_fespace.GetParMesh(),
@@ -1224,9 +1323,67 @@ void WavePortOperator::Initialize(double omega)
         "\nCalculating boundary modes at wave ports for ω/2π = {:.3e} GHz ({:.3e})\n",
         omega * fc, omega);
   }
+
+  // Ports which cannot be interpolated from previous solves are solved in three stages: the
+  // system matrix assembly and postprocessing are collective over all processes, while the
+  // eigenvalue problems are solved concurrently on each port's communicator.
+  auto SolveModes = [this](const std::map<int, bool> &solve, double omega)
+  {
+    for (auto &[idx, data] : ports)
+    {
+      if (solve.at(idx))
+      {
+        data.AssembleModeProblem(omega);
+      }
+    }
+    for (auto &[idx, data] : ports)
+    {
+      if (solve.at(idx))
+      {
+        data.SolveModeProblem();
+      }
+    }
+    for (auto &[idx, data] : ports)
+    {
+      if (solve.at(idx))
+      {
+        data.UpdateMode(omega);
+      }
+    }
+  };
+
+  // When there is no previous exact solve above the requested frequency, first solve for
+  // the mode at an anchor frequency ahead (when scheduled) and retry the interpolation. The
+  // anchor solve is reused for the following frequencies up to the anchor.
+  std::map<int, bool> solve, interp, anchor;
+  const double omega_anchor = std::min(omega + anchor_delta_omega, anchor_omega_max);
+  bool solve_anchor = false;
+  for (auto &[idx, data] : ports)
+  {
+    const bool update = (data.omega0 != omega);
+    interp[idx] = update && data.InterpolateMode(omega);
+    anchor[idx] = update && !interp[idx] && anchor_delta_omega > 0.0 &&
+                  omega_anchor > omega && data.NeedsModeAnchor(omega);
+    solve_anchor = solve_anchor || anchor[idx];
+  }
+  if (solve_anchor)
+  {
+    SolveModes(anchor, omega_anchor);
+    for (auto &[idx, data] : ports)
+    {
+      if (anchor[idx])
+      {
+        interp[idx] = data.InterpolateMode(omega);
+      }
+    }
+  }
+  for (auto &[idx, data] : ports)
+  {
+    solve[idx] = (data.omega0 != omega) && !interp[idx];
+  }
+  SolveModes(solve, omega);
   for (auto &[idx, data] : ports)
   {
-    data.Initialize(omega);
     if (!suppress_output)
     {
       if (first)
@@ -1235,8 +1392,9 @@ void WavePortOperator::Initialize(double omega)
                    "  H1: {:d}, ND: {:d}\n",
                    idx, data.GlobalTrueH1Size(), data.GlobalTrueNDSize());
       }
-      Mpi::Print(" Port {:d}, mode {:d}: kₙ = {:.3e}{:+.3e}i m⁻¹\n", idx, data.mode_idx,
-                 data.kn0.real() * kc, data.kn0.imag() * kc);
+      Mpi::Print(" Port {:d}, mode {:d}: kₙ = {:.3e}{:+.3e}i m⁻¹{}\n", idx, data.mode_idx,
+                 data.kn0.real() * kc, data.kn0.imag() * kc,
+                 interp[idx] ? " (interpolated)" : "");
     }
   }
 }
@@ -1286,4 +1444,16 @@ void WavePortOperator::AddExcitationBdrCoefficients(double omega, SumVectorCoeff
   }
 }
 
+void WavePortOperator::AddExcitationBdrCoefficients(int idx, double omega,
+                                                    SumVectorCoefficient &fbr,
+                                                    SumVectorCoefficient &fbi)
+{
+  // Construct the RHS source term for a single excited wave port index.
+  Initialize(omega);
+  const WavePortData &data = GetPort(idx);
+  MFEM_VERIFY(data.excitation, "Wave port index " << idx << " is not marked for excitation!");
+  fbr.AddCoefficient(data.GetModeExcitationCoefficientImag(), 2.0 * omega);
+  fbi.AddCoefficient(data.GetModeExcitationCoefficientReal(), -2.0 * omega);
+}
+
 }  // namespace palace
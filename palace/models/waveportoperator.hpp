@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include <mfem.hpp>
 #include "fem/fespace.hpp"
 #include "fem/gridfunction.hpp"
@@ -64,10 +65,24 @@ private:
   mfem::Array<int> port_dbc_tdof_list;
   double mu_eps_min;
 
-  // Operator storage for repeated boundary mode eigenvalue problem solves.
+  // Operator storage for repeated boundary mode eigenvalue problem solves. The initial
+  // space v0 is updated with the most recently computed mode to warm start the next solve.
   std::unique_ptr<mfem::HypreParMatrix> Atnr, Atni, Antr, Anti, Annr, Anni;
-  std::unique_ptr<ComplexOperator> B0;
+  std::unique_ptr<ComplexOperator> A, B0;
   ComplexVector v0, e0;
+  std::complex<double> lambda;
+
+  // Cache of exact boundary mode solutions (normalized mode fields on the port), used for
+  // interpolating the mode at intermediate frequencies to the specified relative tolerance.
+  // Interpolation is disabled when the tolerance is zero.
+  struct ModeData
+  {
+    double omega;
+    std::complex<double> kn;
+    ComplexVector E0t, E0n;
+  };
+  std::vector<ModeData> mode_cache;
+  double interp_tol;
 
   // Eigenvalue solver for boundary modes.
   MPI_Comm port_comm;
@@ -81,6 +96,10 @@ private:
   std::unique_ptr<GridFunction> port_E0t, port_E0n, port_S0t, port_E;
   std::unique_ptr<mfem::LinearForm> port_sr, port_si;
 
+  // Configure the linear forms for S-parameter computation and normalize the port mode
+  // after it has been updated.
+  void UpdateModeNormalization();
+
 public:
   WavePortData(const config::WavePortData &data, const config::SolverData &solver,
                const MaterialOperator &mat_op, mfem::ParFiniteElementSpace &nd_fespace,
@@ -89,8 +108,22 @@ public:
 
   const auto &GetAttrList() const { return attr_list; }
 
+  // Compute the boundary mode at the specified frequency.
   void Initialize(double omega);
 
+  // Stages of Initialize for computing the boundary mode. The eigenvalue problem solve in
+  // SolveModeProblem is only collective on the processes which share the port boundary, so
+  // solves for ports with distinct processes can proceed concurrently. InterpolateMode
+  // returns false if the mode cannot be interpolated from previous solves bracketing the
+  // frequency to within the tolerance, in which case the full solve is required.
+  // NeedsModeAnchor returns true if interpolation is enabled but there is no previous exact
+  // solve above the frequency to interpolate with.
+  bool InterpolateMode(double omega);
+  bool NeedsModeAnchor(double omega) const;
+  void AssembleModeProblem(double omega);
+  void SolveModeProblem();
+  void UpdateMode(double omega);
+
   HYPRE_BigInt GlobalTrueNDSize() const { return port_nd_fespace->GlobalTrueVSize(); }
   HYPRE_BigInt GlobalTrueH1Size() const { return port_h1_fespace->GlobalTrueVSize(); }
 
@@ -135,6 +168,11 @@ private:
   bool suppress_output;
   double fc, kc;
 
+  // Frequency spacing and upper limit for exact boundary mode solves scheduled ahead of the
+  // requested frequency, so that modes can be interpolated in a sweep of increasing
+  // frequency. Disabled when the spacing is zero.
+  double anchor_delta_omega, anchor_omega_max;
+
   void SetUpBoundaryProperties(const IoData &iodata, const MaterialOperator &mat_op,
                                mfem::ParFiniteElementSpace &nd_fespace,
                                mfem::ParFiniteElementSpace &h1_fespace);
@@ -159,6 +197,14 @@ public:
   // Enable or suppress all outputs (log printing and fields to disk).
   void SetSuppressOutput(bool suppress) { suppress_output = suppress; }
 
+  // Schedule exact boundary mode solves ahead of the requested frequency, spaced by
+  // delta_omega up to omega_max, for ports with mode interpolation enabled.
+  void SetModeAnchors(double delta_omega, double omega_max)
+  {
+    anchor_delta_omega = delta_omega;
+    anchor_omega_max = omega_max;
+  }
+
   // Returns array of wave port attributes.
   mfem::Array<int> GetAttrList() const;
 
@@ -170,6 +216,8 @@ public:
   // excited port boundaries.
   void AddExcitationBdrCoefficients(double omega, SumVectorCoefficient &fbr,
                                     SumVectorCoefficient &fbi);
+  void AddExcitationBdrCoefficients(int idx, double omega, SumVectorCoefficient &fbr,
+                                    SumVectorCoefficient &fbi);
 };
 
 }  // namespace palace
@@ -227,6 +227,7 @@ void ProblemData::SetUp(json &config)
   type = problem->at("Type");  // Required
   verbose = problem->value("Verbose", verbose);
   output = problem->value("Output", output);
+  trace = problem->value("Trace", trace);
 
   // Check for provided solver configuration data (not required for electrostatics or
   // magnetostatics since defaults can be used for every option).
@@ -268,6 +269,7 @@ void ProblemData::SetUp(json &config)
   problem->erase("Type");
   problem->erase("Verbose");
   problem->erase("Output");
+  problem->erase("Trace");
   MFEM_VERIFY(problem->empty(),
               "Found an unsupported configuration file keyword under \"Problem\"!\n"
                   << problem->dump(2));
@@ -276,6 +278,7 @@ void ProblemData::SetUp(json &config)
   // std::cout << "Type: " << type << '\n';
   // std::cout << "Verbose: " << verbose << '\n';
   // std::cout << "Output: " << output << '\n';
+  // std::cout << "Trace: " << trace << '\n';
 }
 
 void RefinementData::SetUp(json &model)
@@ -463,6 +466,7 @@ void ModelData::SetUp(json &config)
   partition = model->value("Partition", partition);
   reorient_tet = model->value("ReorientTetMesh", reorient_tet);
   remove_curvature = model->value("RemoveCurvature", remove_curvature);
+  mesh_cache = model->value("MeshCache", mesh_cache);
   refinement.SetUp(*model);
 
   // Cleanup
@@ -472,6 +476,7 @@ void ModelData::SetUp(json &config)
   model->erase("Partition");
   model->erase("ReorientTetMesh");
   model->erase("RemoveCurvature");
+  model->erase("MeshCache");
   model->erase("Refinement");
   MFEM_VERIFY(model->empty(),
               "Found an unsupported configuration file keyword under \"Model\"!\n"
@@ -484,6 +489,7 @@ void ModelData::SetUp(json &config)
   // std::cout << "Partition: " << partition << '\n';
   // std::cout << "ReorientTetMesh: " << reorient_tet << '\n';
   // std::cout << "RemoveCurvature: " << remove_curvature << '\n';
+  // std::cout << "MeshCache: " << mesh_cache << '\n';
 }
 
 void DomainMaterialData::SetUp(json &domains)
@@ -1023,6 +1029,9 @@ void WavePortBoundaryData::SetUp(json &boundaries)
     data.d_offset = it->value("Offset", data.d_offset);
     data.excitation = it->value("Excitation", data.excitation);
     data.active = it->value("Active", data.active);
+    data.interp_tol = it->value("InterpolationTol", data.interp_tol);
+    MFEM_VERIFY(data.interp_tol >= 0.0,
+                "\"WavePort\" boundary \"InterpolationTol\" must be non-negative!");
 
     // Debug
     // std::cout << "Index: " << ret.first->first << '\n';
@@ -1031,6 +1040,7 @@ void WavePortBoundaryData::SetUp(json &boundaries)
     // std::cout << "Offset: " << data.d_offset << '\n';
     // std::cout << "Excitation: " << data.excitation << '\n';
     // std::cout << "Active: " << data.active << '\n';
+    // std::cout << "InterpolationTol: " << data.interp_tol << '\n';
 
     // Cleanup
     it->erase("Index");
@@ -1039,6 +1049,7 @@ void WavePortBoundaryData::SetUp(json &boundaries)
     it->erase("Offset");
     it->erase("Excitation");
     it->erase("Active");
+    it->erase("InterpolationTol");
     MFEM_VERIFY(it->empty(),
                 "Found an unsupported configuration file keyword under \"WavePort\"!\n"
                     << it->dump(2));
@@ -1430,10 +1441,15 @@ void DrivenSolverData::SetUp(json &solver)
   delta_f = driven->at("FreqStep");  // Required
   delta_post = driven->value("SaveStep", delta_post);
   only_port_post = driven->value("SaveOnlyPorts", only_port_post);
+  full_s_matrix = driven->value("FullSMatrix", full_s_matrix);
   rst = driven->value("Restart", rst);
+  freq_groups = driven->value("FreqGroups", freq_groups);
   adaptive_tol = driven->value("AdaptiveTol", adaptive_tol);
   adaptive_max_size = driven->value("AdaptiveMaxSamples", adaptive_max_size);
   adaptive_memory = driven->value("AdaptiveConvergenceMemory", adaptive_memory);
+  adaptive_batch_size = driven->value("AdaptiveBatchSize", adaptive_batch_size);
+  adaptive_save_basis = driven->value("AdaptiveSaveBasis", adaptive_save_basis);
+  adaptive_load_basis = driven->value("AdaptiveLoadBasis", adaptive_load_basis);
 
   // Cleanup
   driven->erase("MinFreq");
@@ -1441,10 +1457,15 @@ void DrivenSolverData::SetUp(json &solver)
   driven->erase("FreqStep");
   driven->erase("SaveStep");
   driven->erase("SaveOnlyPorts");
+  driven->erase("FullSMatrix");
   driven->erase("Restart");
+  driven->erase("FreqGroups");
   driven->erase("AdaptiveTol");
   driven->erase("AdaptiveMaxSamples");
   driven->erase("AdaptiveConvergenceMemory");
+  driven->erase("AdaptiveBatchSize");
+  driven->erase("AdaptiveSaveBasis");
+  driven->erase("AdaptiveLoadBasis");
   MFEM_VERIFY(driven->empty(),
               "Found an unsupported configuration file keyword under \"Driven\"!\n"
                   << driven->dump(2));
@@ -1455,10 +1476,15 @@ void DrivenSolverData::SetUp(json &solver)
   // std::cout << "FreqStep: " << delta_f << '\n';
   // std::cout << "SaveStep: " << delta_post << '\n';
   // std::cout << "SaveOnlyPorts: " << only_port_post << '\n';
+  // std::cout << "FullSMatrix: " << full_s_matrix << '\n';
   // std::cout << "Restart: " << rst << '\n';
+  // std::cout << "FreqGroups: " << freq_groups << '\n';
   // std::cout << "AdaptiveTol: " << adaptive_tol << '\n';
   // std::cout << "AdaptiveMaxSamples: " << adaptive_max_size << '\n';
   // std::cout << "AdaptiveConvergenceMemory: " << adaptive_memory << '\n';
+  // std::cout << "AdaptiveBatchSize: " << adaptive_batch_size << '\n';
+  // std::cout << "AdaptiveSaveBasis: " << adaptive_save_basis << '\n';
+  // std::cout << "AdaptiveLoadBasis: " << adaptive_load_basis << '\n';
 }
 
 // Helper for converting string keys to enum for EigenSolverData::Type.
@@ -1617,6 +1643,12 @@ void TransientSolverData::SetUp(json &solver)
   delta_t = transient->at("TimeStep");  // Required
   delta_post = transient->value("SaveStep", delta_post);
   only_port_post = transient->value("SaveOnlyPorts", only_port_post);
+  adaptive_tol = transient->value("AdaptiveTol", adaptive_tol);
+  adaptive_max_levels = transient->value("AdaptiveMaxLevels", adaptive_max_levels);
+  MFEM_VERIFY(adaptive_tol >= 0.0,
+              "config[\"Transient\"][\"AdaptiveTol\"] must be non-negative!");
+  MFEM_VERIFY(adaptive_max_levels >= 0,
+              "config[\"Transient\"][\"AdaptiveMaxLevels\"] must be non-negative!");
 
   // Cleanup
   transient->erase("Type");
@@ -1627,6 +1659,8 @@ void TransientSolverData::SetUp(json &solver)
   transient->erase("TimeStep");
   transient->erase("SaveStep");
   transient->erase("SaveOnlyPorts");
+  transient->erase("AdaptiveTol");
+  transient->erase("AdaptiveMaxLevels");
   MFEM_VERIFY(transient->empty(),
               "Found an unsupported configuration file keyword under \"Transient\"!\n"
                   << transient->dump(2));
@@ -1640,6 +1674,8 @@ void TransientSolverData::SetUp(json &solver)
   // std::cout << "TimeStep: " << delta_t << '\n';
   // std::cout << "SaveStep: " << delta_post << '\n';
   // std::cout << "SaveOnlyPorts: " << only_port_post << '\n';
+  // std::cout << "AdaptiveTol: " << adaptive_tol << '\n';
+  // std::cout << "AdaptiveMaxLevels: " << adaptive_max_levels << '\n';
 }
 
 // Helpers for converting string keys to enum for LinearSolverData::Type,
@@ -1661,7 +1697,10 @@ PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::KspType,
                             {LinearSolverData::KspType::MINRES, "MINRES"},
                             {LinearSolverData::KspType::GMRES, "GMRES"},
                             {LinearSolverData::KspType::FGMRES, "FGMRES"},
-                            {LinearSolverData::KspType::BICGSTAB, "BiCGSTAB"}})
+                            {LinearSolverData::KspType::BICGSTAB, "BiCGSTAB"},
+                            {LinearSolverData::KspType::COCG, "COCG"},
+                            {LinearSolverData::KspType::COCR, "COCR"},
+                            {LinearSolverData::KspType::GCRODR, "GCRODR"}})
 PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::SideType,
                            {{LinearSolverData::SideType::DEFAULT, "Default"},
                             {LinearSolverData::SideType::RIGHT, "Right"},
@@ -1691,7 +1730,9 @@ PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::CompressionType,
 PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::OrthogType,
                            {{LinearSolverData::OrthogType::MGS, "MGS"},
                             {LinearSolverData::OrthogType::CGS, "CGS"},
-                            {LinearSolverData::OrthogType::CGS2, "CGS2"}})
+                            {LinearSolverData::OrthogType::CGS2, "CGS2"},
+                            {LinearSolverData::OrthogType::CGS_FUSED, "CGSFused"},
+                            {LinearSolverData::OrthogType::CGS2_FUSED, "CGS2Fused"}})
 
 void LinearSolverData::SetUp(json &solver)
 {
@@ -1705,6 +1746,8 @@ void LinearSolverData::SetUp(json &solver)
   tol = linear->value("Tol", tol);
   max_it = linear->value("MaxIts", max_it);
   max_size = linear->value("MaxSize", max_size);
+  bicgstab_order = linear->value("BiCGStabOrder", bicgstab_order);
+  recycle_size = linear->value("RecycleSize", recycle_size);
   initial_guess = linear->value("InitialGuess", initial_guess);
 
   // Options related to multigrid.
@@ -1718,10 +1761,12 @@ void LinearSolverData::SetUp(json &solver)
   mg_smooth_sf_max = linear->value("MGSmoothEigScaleMax", mg_smooth_sf_max);
   mg_smooth_sf_min = linear->value("MGSmoothEigScaleMin", mg_smooth_sf_min);
   mg_smooth_cheby_4th = linear->value("MGSmoothChebyshev4th", mg_smooth_cheby_4th);
+  mg_single_precision = linear->value("MGSinglePrecision", mg_single_precision);
 
   // Preconditioner-specific options.
   pc_mat_real = linear->value("PCMatReal", pc_mat_real);
   pc_mat_shifted = linear->value("PCMatShifted", pc_mat_shifted);
+  pc_reuse_its_growth = linear->value("PCReuseItsGrowth", pc_reuse_its_growth);
   pc_side_type = linear->value("PCSide", pc_side_type);
   sym_fact_type = linear->value("ColumnOrdering", sym_fact_type);
   strumpack_compression_type =
@@ -1747,6 +1792,8 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("Tol");
   linear->erase("MaxIts");
   linear->erase("MaxSize");
+  linear->erase("BiCGStabOrder");
+  linear->erase("RecycleSize");
   linear->erase("InitialGuess");
 
   linear->erase("MGMaxLevels");
@@ -1759,9 +1806,11 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("MGSmoothEigScaleMax");
   linear->erase("MGSmoothEigScaleMin");
   linear->erase("MGSmoothChebyshev4th");
+  linear->erase("MGSinglePrecision");
 
   linear->erase("PCMatReal");
   linear->erase("PCMatShifted");
+  linear->erase("PCReuseItsGrowth");
   linear->erase("PCSide");
   linear->erase("ColumnOrdering");
   linear->erase("STRUMPACKCompressionType");
@@ -1787,6 +1836,8 @@ void LinearSolverData::SetUp(json &solver)
   // std::cout << "Tol: " << tol << '\n';
   // std::cout << "MaxIts: " << max_it << '\n';
   // std::cout << "MaxSize: " << max_size << '\n';
+  // std::cout << "BiCGStabOrder: " << bicgstab_order << '\n';
+  // std::cout << "RecycleSize: " << recycle_size << '\n';
   // std::cout << "InitialGuess: " << initial_guess << '\n';
 
   // std::cout << "MGMaxLevels: " << mg_max_levels << '\n';
@@ -1799,9 +1850,11 @@ void LinearSolverData::SetUp(json &solver)
   // std::cout << "MGSmoothEigScaleMax: " << mg_smooth_sf_max << '\n';
   // std::cout << "MGSmoothEigScaleMin: " << mg_smooth_sf_min << '\n';
   // std::cout << "MGSmoothChebyshev4th: " << mg_smooth_cheby_4th << '\n';
+  // std::cout << "MGSinglePrecision: " << mg_single_precision << '\n';
 
   // std::cout << "PCMatReal: " << pc_mat_real << '\n';
   // std::cout << "PCMatShifted: " << pc_mat_shifted << '\n';
+  // std::cout << "PCReuseItsGrowth: " << pc_reuse_its_growth << '\n';
   // std::cout << "PCSide: " << pc_side_type << '\n';
   // std::cout << "ColumnOrdering: " << sym_fact_type << '\n';
   // std::cout << "STRUMPACKCompressionType: " << strumpack_compression_type << '\n';
@@ -1834,6 +1887,7 @@ void SolverData::SetUp(json &config)
   pa_order_threshold = solver->value("PartialAssemblyOrder", pa_order_threshold);
   q_order_jac = solver->value("QuadratureOrderJacobian", q_order_jac);
   q_order_extra = solver->value("QuadratureOrderExtra", q_order_extra);
+  fused_system_mat = solver->value("FusedSystemMatrix", fused_system_mat);
   device = solver->value("Device", device);
   ceed_backend = solver->value("Backend", ceed_backend);
 
@@ -1849,6 +1903,7 @@ void SolverData::SetUp(json &config)
   solver->erase("PartialAssemblyOrder");
   solver->erase("QuadratureOrderJacobian");
   solver->erase("QuadratureOrderExtra");
+  solver->erase("FusedSystemMatrix");
   solver->erase("Device");
   solver->erase("Backend");
 
@@ -1867,6 +1922,7 @@ void SolverData::SetUp(json &config)
   // std::cout << "PartialAssemblyOrder: " << pa_order_threshold << '\n';
   // std::cout << "QuadratureOrderJacobian: " << q_order_jac << '\n';
   // std::cout << "QuadratureOrderExtra: " << q_order_extra << '\n';
+  // std::cout << "FusedSystemMatrix: " << fused_system_mat << '\n';
   // std::cout << "Device: " << device << '\n';
   // std::cout << "Backend: " << ceed_backend << '\n';
 }
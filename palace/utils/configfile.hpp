@@ -109,6 +109,9 @@ public:
   // Output path for storing results.
   std::string output = "";
 
+  // Write a trace of the profiled regions for all processes.
+  bool trace = false;
+
   void SetUp(json &config);
 };
 
@@ -208,6 +211,10 @@ public:
   // Remove high-order curvature information from the mesh.
   bool remove_curvature = false;
 
+  // Directory for the partitioned mesh cache (if specified, the partitioned mesh is written
+  // on the first run and read in parallel by all processes on subsequent runs).
+  std::string mesh_cache = "";
+
   // Object controlling mesh refinement.
   RefinementData refinement = {};
 
@@ -451,6 +458,10 @@ public:
   // Flag for boundary damping term in driven and transient simulations.
   bool active = true;
 
+  // Relative tolerance for interpolating the port mode between frequencies from previous
+  // boundary mode solves (zero disables interpolation).
+  double interp_tol = 0.0;
+
   // List of boundary attributes for this wave port.
   std::vector<int> attributes = {};
 };
@@ -581,9 +592,17 @@ public:
   // Only perform postprocessing on port boundaries, skipping domain interior.
   bool only_port_post = false;
 
+  // Compute the full scattering matrix by solving for each excited port separately, with
+  // all excitations sharing the system operator and preconditioner at each frequency.
+  bool full_s_matrix = false;
+
   // Restart iteration for a partial sweep.
   int rst = 1;
 
+  // Number of process groups for parallel-in-frequency uniform sweeps. Each group solves a
+  // strided subset of the frequency steps on a copy of the mesh.
+  int freq_groups = 1;
+
   // Error tolerance for enabling adaptive frequency sweep.
   double adaptive_tol = 0.0;
 
@@ -593,6 +612,18 @@ public:
   // Memory required for adaptive sampling convergence.
   int adaptive_memory = 2;
 
+  // Number of frequency samples added to the adaptive frequency sweep basis per greedy
+  // iteration.
+  int adaptive_batch_size = 1;
+
+  // Save the reduced-order model for adaptive frequency sweep to disk after the offline
+  // phase.
+  bool adaptive_save_basis = false;
+
+  // Directory containing a previously saved reduced-order model to load for adaptive
+  // frequency sweep.
+  std::string adaptive_load_basis = "";
+
   void SetUp(json &solver);
 };
 
@@ -714,6 +745,14 @@ public:
   // Only perform postprocessing on port boundaries, skipping domain interior.
   bool only_port_post = false;
 
+  // Relative local error tolerance for adaptive time step selection (0 uses fixed time
+  // steps).
+  double adaptive_tol = 0.0;
+
+  // Maximum number of step size doublings relative to the initial time step, for adaptive
+  // time stepping.
+  int adaptive_max_levels = 4;
+
   void SetUp(json &solver);
 };
 
@@ -742,7 +781,10 @@ public:
     MINRES,
     GMRES,
     FGMRES,
-    BICGSTAB
+    BICGSTAB,
+    COCG,
+    COCR,
+    GCRODR
   };
   KspType ksp_type = KspType::DEFAULT;
 
@@ -755,6 +797,13 @@ public:
   // Maximum Krylov space dimension for GMRES/FGMRES iterative solvers.
   int max_size = -1;
 
+  // Degree of the minimal residual polynomial for the BiCGStab(ℓ) iterative solver.
+  int bicgstab_order = 2;
+
+  // Maximum dimension of the subspace recycled across restarts and consecutive solves for
+  // the GCRO-DR iterative solver.
+  int recycle_size = 10;
+
   // Reuse previous solution as initial guess for Krylov solvers.
   int initial_guess = -1;
 
@@ -796,6 +845,11 @@ public:
   // use standard 1st-kind polynomials.
   bool mg_smooth_cheby_4th = true;
 
+  // Pre-assemble and store the quadrature data for multigrid preconditioner operators in
+  // single precision, when using operator partial assembly. The outer Krylov iteration
+  // remains in double precision. Ignored for meshes with affine simplex elements.
+  bool mg_single_precision = false;
+
   // For frequency domain applications, precondition linear systems with a real-valued
   // approximation to the system matrix.
   bool pc_mat_real = false;
@@ -804,6 +858,11 @@ public:
   // (makes the preconditoner matrix SPD).
   int pc_mat_shifted = -1;
 
+  // For frequency sweeps, reuse the preconditioner from a previous frequency as long as the
+  // number of Krylov iterations stays below this factor times the number of iterations of
+  // the first solve after the most recent preconditioner setup (zero disables reuse).
+  double pc_reuse_its_growth = 0.0;
+
   // Choose left or right preconditioning.
   enum class SideType
   {
@@ -873,7 +932,9 @@ public:
   {
     MGS,
     CGS,
-    CGS2
+    CGS2,
+    CGS_FUSED,
+    CGS2_FUSED
   };
   OrthogType gs_orthog_type = OrthogType::MGS;
 
@@ -896,6 +957,10 @@ public:
   // quadrature rule selection.
   int q_order_extra = 0;
 
+  // Assemble the system matrix as a single fused operator when using partial assembly,
+  // rather than as a sum of the stiffness, damping, and mass operators.
+  bool fused_system_mat = true;
+
   // Device used to configure MFEM.
   enum class Device
   {
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <fstream>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -60,6 +62,17 @@ std::unique_ptr<mfem::ParMesh> DistributeMesh(MPI_Comm, std::unique_ptr<mfem::Me
 // mesh onto the root rank before scattering the partitioned mesh.
 void RebalanceConformalMesh(std::unique_ptr<mfem::ParMesh> &);
 
+// Compute the key identifying a partitioned mesh in the mesh cache, from the contents of
+// the mesh (and partitioning) file, the number of processes, and the preprocessing options.
+std::uint64_t GetMeshCacheKey(MPI_Comm, const IoData &, bool, bool, bool, bool);
+
+// Read the partitioned mesh for each process from the mesh cache directory. If any process
+// does not find a valid cache file for the given key, returns nullptr on all processes.
+std::unique_ptr<mfem::ParMesh> ReadMeshCache(MPI_Comm, const std::string &, std::uint64_t);
+
+// Write the partitioned mesh for each process to the mesh cache directory.
+void WriteMeshCache(const mfem::ParMesh &, const std::string &, std::uint64_t);
+
 }  // namespace
 
 namespace mesh
@@ -77,6 +90,42 @@ std::unique_ptr<mfem::ParMesh> ReadMesh(MPI_Comm comm, const IoData &iodata, boo
   const auto &refinement = iodata.model.refinement;
   const bool use_amr = refinement.max_it > 0;
   const bool use_mesh_partitioner = !use_amr || !refinement.nonconformal;
+  auto CheckElementTypes = [&](const ElementTypeInfo &element_types)
+  {
+    // Check the the AMR specification and the mesh elements are compatible.
+    MFEM_VERIFY(!use_amr || !element_types.has_hexahedra || refinement.nonconformal,
+                "If there are tensor elements, AMR must be nonconformal!");
+    MFEM_VERIFY(!use_amr || !element_types.has_pyramids || refinement.nonconformal,
+                "If there are pyramid elements, AMR must be nonconformal!");
+    MFEM_VERIFY(!use_amr || !element_types.has_prisms || refinement.nonconformal,
+                "If there are wedge elements, AMR must be nonconformal!");
+  };
+
+  // When using the mesh partitioner, first look for the partitioned mesh from a previous
+  // run in the mesh cache. Each process reads its own part, skipping the serial
+  // preprocessing and distribution entirely.
+  const std::string &cache_dir = iodata.model.mesh_cache;
+  const bool use_mesh_cache = use_mesh_partitioner && !cache_dir.empty();
+  std::uint64_t cache_key = 0;
+  if (use_mesh_cache)
+  {
+    BlockTimer bt(Timer::IO);
+    cache_key = GetMeshCacheKey(comm, iodata, reorder, clean_elem, add_bdr, add_subdomain);
+    auto pmesh = ReadMeshCache(comm, cache_dir, cache_key);
+    if (pmesh)
+    {
+      const auto element_types = CheckElements(*pmesh);
+      std::array<bool, 3> has_types = {element_types.has_hexahedra,
+                                        element_types.has_pyramids,
+                                        element_types.has_prisms};
+      Mpi::GlobalOr(3, has_types.data(), comm);
+      CheckElementTypes(
+          {element_types.has_simplices, has_types[0], has_types[1], has_types[2]});
+      Mpi::Print(comm, "\nRead partitioned mesh from cache (key = {:016x})\n", cache_key);
+      return pmesh;
+    }
+  }
+
   {
     BlockTimer bt(Timer::IO);
     if (Mpi::Root(comm) || !use_mesh_partitioner)
@@ -92,13 +141,7 @@ std::unique_ptr<mfem::ParMesh> ReadMesh(MPI_Comm comm, const IoData &iodata, boo
   if (Mpi::Root(comm) || !use_mesh_partitioner)
   {
     // Check the the AMR specification and the mesh elements are compatible.
-    const auto element_types = CheckElements(*smesh);
-    MFEM_VERIFY(!use_amr || !element_types.has_hexahedra || refinement.nonconformal,
-                "If there are tensor elements, AMR must be nonconformal!");
-    MFEM_VERIFY(!use_amr || !element_types.has_pyramids || refinement.nonconformal,
-                "If there are pyramid elements, AMR must be nonconformal!");
-    MFEM_VERIFY(!use_amr || !element_types.has_prisms || refinement.nonconformal,
-                "If there are wedge elements, AMR must be nonconformal!");
+    CheckElementTypes(CheckElements(*smesh));
 
     // Optionally reorder elements (and vertices) based on spatial location after loading
     // the serial mesh.
@@ -130,6 +173,11 @@ std::unique_ptr<mfem::ParMesh> ReadMesh(MPI_Comm comm, const IoData &iodata, boo
   if (use_mesh_partitioner)
   {
     pmesh = DistributeMesh(comm, smesh, partitioning.get(), iodata.problem.output);
+    if (use_mesh_cache)
+    {
+      BlockTimer bt(Timer::IO);
+      WriteMeshCache(*pmesh, cache_dir, cache_key);
+    }
   }
   else
   {
@@ -1371,6 +1419,59 @@ double RebalanceMesh(std::unique_ptr<mfem::ParMesh> &mesh, const IoData &iodata)
   return ratio;
 }
 
+std::unique_ptr<mfem::ParMesh> ReplicateMesh(const mfem::ParMesh &mesh, MPI_Comm group_comm)
+{
+  // Gather the serial mesh on the root of the parent communicator and send a copy to the
+  // root of each process group, which then partitions and distributes it across the
+  // processes of its group. Each group root must have the same rank ordering in the parent
+  // communicator as in the group, so the parent root is also the root of its group.
+  MPI_Comm comm = mesh.GetComm();
+  MFEM_VERIFY(mesh.Conforming(),
+              "Replicating a mesh across process groups requires a conforming mesh!");
+  MFEM_VERIFY(!Mpi::Root(comm) || Mpi::Root(group_comm),
+              "Root process of the parent communicator must be the root of its group for "
+              "mesh replication!");
+  constexpr bool generate_edges = true, refine = true, fix_orientation = true;
+  std::unique_ptr<mfem::Mesh> smesh;
+  {
+    std::string so;
+    {
+      mfem::Mesh gmesh = mesh.GetSerialMesh(0);
+      if (Mpi::Root(comm))
+      {
+        std::ostringstream fo(std::stringstream::out);
+        fo << std::scientific;
+        fo.precision(MSH_FLT_PRECISION);
+        gmesh.Print(fo);
+        so = fo.str();
+      }
+    }
+    MPI_Comm root_comm;
+    MPI_Comm_split(comm, Mpi::Root(group_comm) ? 0 : MPI_UNDEFINED, Mpi::Rank(comm),
+                   &root_comm);
+    if (Mpi::Root(group_comm))
+    {
+      int slen = static_cast<int>(so.length());
+      MFEM_VERIFY(so.length() == (std::size_t)slen,
+                  "Overflow error replicating parallel mesh!");
+      Mpi::Broadcast(1, &slen, 0, root_comm);
+      so.resize(slen);
+      Mpi::Broadcast(slen, so.data(), 0, root_comm);
+      MPI_Comm_free(&root_comm);
+      std::istringstream fi(so);
+      smesh = std::make_unique<mfem::Mesh>(fi, generate_edges, refine, fix_orientation);
+    }
+  }
+
+  // Partition and distribute on each group.
+  std::unique_ptr<int[]> partitioning;
+  if (Mpi::Root(group_comm))
+  {
+    partitioning = GetMeshPartitioning(*smesh, Mpi::Size(group_comm), "", false);
+  }
+  return DistributeMesh(group_comm, smesh, partitioning.get());
+}
+
 template void AttrToMarker(int, const mfem::Array<int> &, mfem::Array<int> &, bool);
 template void AttrToMarker(int, const std::vector<int> &, mfem::Array<int> &, bool);
 
@@ -1389,52 +1490,15 @@ std::unique_ptr<mfem::Mesh> LoadMesh(const std::string &path, bool remove_curvat
   constexpr bool generate_edges = true, refine = true, fix_orientation = true;
   std::unique_ptr<mfem::Mesh> mesh;
   std::filesystem::path mfile(path);
-  if (mfile.extension() == ".mphtxt" || mfile.extension() == ".mphbin" ||
-      mfile.extension() == ".nas" || mfile.extension() == ".bdf")
-  {
-    // Put translated mesh in temporary string buffer.
-    std::stringstream fi(std::stringstream::in | std::stringstream::out);
-    // fi << std::fixed;
-    fi << std::scientific;
-    fi.precision(MSH_FLT_PRECISION);
-
-#if 0
-    // Put translated mesh in temporary storage (directory is created and destroyed in
-    // calling function).
-    std::string tmp = iodata.problem.output;
-    if (tmp.back() != '/')
-    {
-      tmp += '/';
-    }
-    tmp += "tmp/serial.msh";
-    std::ofstream fo(tmp);
-    // mfem::ofgzstream fo(tmp, true);  // Use zlib compression if available
-    // fo << std::fixed;
-    fo << std::scientific;
-    fo.precision(MSH_FLT_PRECISION);
-#endif
-
-    if (mfile.extension() == ".mphtxt" || mfile.extension() == ".mphbin")
-    {
-      mesh::ConvertMeshComsol(path, fi, remove_curvature);
-      // mesh::ConvertMeshComsol(path, fo, remove_curvature);
-    }
-    else
-    {
-      mesh::ConvertMeshNastran(path, fi, remove_curvature);
-      // mesh::ConvertMeshNastran(path, fo, remove_curvature);
-    }
-
-#if 0
-    std::ifstream fi(tmp);
-    // mfem::ifgzstream fi(tmp);
-    if (!fi.good())
-    {
-      MFEM_ABORT("Unable to open translated mesh file \"" << tmp << "\"!");
-    }
-#endif
-
-    mesh = std::make_unique<mfem::Mesh>(fi, generate_edges, refine, fix_orientation);
+  if (mfile.extension() == ".mphtxt" || mfile.extension() == ".mphbin")
+  {
+    // Construct the mesh directly from the parsed nodes and elements, rather than
+    // converting to an intermediate format for MFEM to parse again.
+    mesh = mesh::LoadMeshComsol(path, remove_curvature);
+  }
+  else if (mfile.extension() == ".nas" || mfile.extension() == ".bdf")
+  {
+    mesh = mesh::LoadMeshNastran(path, remove_curvature);
   }
   else
   {
@@ -2087,6 +2151,172 @@ void RebalanceConformalMesh(std::unique_ptr<mfem::ParMesh> &pmesh)
   pmesh = DistributeMesh(comm, smesh, partitioning.get());
 }
 
+// Binary mesh cache files consist of a fixed size header followed by the partitioned mesh
+// for a single process, in MFEM's parallel mesh format.
+struct MeshCacheHeader
+{
+  char magic[8];
+  std::uint64_t version, key, rank, size, length;
+};
+
+constexpr char MESH_CACHE_MAGIC[8] = {'P', 'A', 'L', 'A', 'C', 'E', 'M', 'C'};
+constexpr std::uint64_t MESH_CACHE_VERSION = 1;
+
+// 64-bit FNV-1a hash, see http://www.isthe.com/chongo/tech/comp/fnv/.
+constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+void HashBytes(std::uint64_t &hash, const void *data, std::size_t n)
+{
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t i = 0; i < n; i++)
+  {
+    hash ^= bytes[i];
+    hash *= FNV_PRIME;
+  }
+}
+
+void HashFile(std::uint64_t &hash, const std::string &path)
+{
+  std::ifstream fi(path, std::ios::binary);
+  if (!fi.good())
+  {
+    MFEM_ABORT("Unable to open file \"" << path << "\" for mesh cache!");
+  }
+  std::vector<char> buffer(1 << 20);
+  while (fi)
+  {
+    fi.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    HashBytes(hash, buffer.data(), static_cast<std::size_t>(fi.gcount()));
+  }
+}
+
+void HashAttributes(std::uint64_t &hash, const std::vector<int> &attributes)
+{
+  const std::size_t n = attributes.size();
+  HashBytes(hash, &n, sizeof(n));
+  HashBytes(hash, attributes.data(), n * sizeof(int));
+}
+
+std::string GetMeshCacheFile(const std::string &dir, std::uint64_t key, int rank, int size)
+{
+  const int width = static_cast<int>(std::to_string(std::max(size - 1, 0)).length());
+  return fmt::format("{}{}mesh-{:016x}.{:0{}d}.bin", dir, (dir.back() == '/') ? "" : "/",
+                     key, rank, width);
+}
+
+std::uint64_t GetMeshCacheKey(MPI_Comm comm, const IoData &iodata, bool reorder,
+                              bool clean_elem, bool add_bdr, bool add_subdomain)
+{
+  // Only the root process reads the mesh file to compute the hash. The domain and boundary
+  // attributes in the configuration file affect the mesh preprocessing in CheckMesh.
+  std::uint64_t key = FNV_OFFSET_BASIS;
+  if (Mpi::Root(comm))
+  {
+    HashFile(key, iodata.model.mesh);
+    if (!iodata.model.partition.empty())
+    {
+      HashFile(key, iodata.model.partition);
+    }
+    const std::array<std::uint64_t, 7> options = {
+        MESH_CACHE_VERSION,
+        static_cast<std::uint64_t>(Mpi::Size(comm)),
+        reorder,
+        clean_elem,
+        add_bdr,
+        add_subdomain,
+        iodata.model.remove_curvature};
+    HashBytes(key, options.data(), sizeof(options));
+    if (clean_elem || add_bdr)
+    {
+      HashAttributes(key, iodata.domains.attributes);
+      HashAttributes(key, iodata.boundaries.attributes);
+    }
+  }
+  Mpi::Broadcast(1, &key, 0, comm);
+  return key;
+}
+
+std::unique_ptr<mfem::ParMesh> ReadMeshCache(MPI_Comm comm, const std::string &dir,
+                                             std::uint64_t key)
+{
+  // Validate the header and size of the cache file on every process before constructing
+  // the parallel mesh, which is a collective operation.
+  const std::string path = GetMeshCacheFile(dir, key, Mpi::Rank(comm), Mpi::Size(comm));
+  std::ifstream fi(path, std::ios::binary);
+  bool valid = false;
+  if (fi.good())
+  {
+    MeshCacheHeader header;
+    if (fi.read(reinterpret_cast<char *>(&header), sizeof(header)) &&
+        std::equal(std::begin(MESH_CACHE_MAGIC), std::end(MESH_CACHE_MAGIC),
+                   header.magic) &&
+        header.version == MESH_CACHE_VERSION && header.key == key &&
+        header.rank == static_cast<std::uint64_t>(Mpi::Rank(comm)) &&
+        header.size == static_cast<std::uint64_t>(Mpi::Size(comm)))
+    {
+      const auto start = fi.tellg();
+      fi.seekg(0, std::ios::end);
+      valid = (static_cast<std::uint64_t>(fi.tellg() - start) == header.length);
+      fi.seekg(start);
+    }
+  }
+  Mpi::GlobalAnd(1, &valid, comm);
+  if (!valid)
+  {
+    return nullptr;
+  }
+  constexpr bool generate_edges = true, refine = true, fix_orientation = true;
+  return std::make_unique<mfem::ParMesh>(comm, fi, generate_edges, refine, fix_orientation);
+}
+
+void WriteMeshCache(const mfem::ParMesh &mesh, const std::string &dir, std::uint64_t key)
+{
+  // Each process writes its own part to a temporary file which is renamed when complete,
+  // so an interrupted run never leaves behind a partial cache file with a valid name.
+  MPI_Comm comm = mesh.GetComm();
+  if (Mpi::Root(comm) && !std::filesystem::exists(dir))
+  {
+    std::filesystem::create_directories(dir);
+  }
+  Mpi::Barrier(comm);
+  std::ostringstream fo(std::stringstream::out);
+  fo << std::scientific;
+  fo.precision(MSH_FLT_PRECISION);
+  mesh.ParPrint(fo);
+  const std::string data = fo.str();
+  MeshCacheHeader header;
+  std::copy(std::begin(MESH_CACHE_MAGIC), std::end(MESH_CACHE_MAGIC), header.magic);
+  header.version = MESH_CACHE_VERSION;
+  header.key = key;
+  header.rank = static_cast<std::uint64_t>(Mpi::Rank(comm));
+  header.size = static_cast<std::uint64_t>(Mpi::Size(comm));
+  header.length = data.length();
+  const std::string path = GetMeshCacheFile(dir, key, Mpi::Rank(comm), Mpi::Size(comm));
+  bool success = false;
+  {
+    std::ofstream of(path + ".tmp", std::ios::binary);
+    if (of.good())
+    {
+      of.write(reinterpret_cast<const char *>(&header), sizeof(header));
+      of.write(data.data(), static_cast<std::streamsize>(data.length()));
+      success = of.good();
+    }
+  }
+  if (success)
+  {
+    std::error_code ec;
+    std::filesystem::rename(path + ".tmp", path, ec);
+    success = !ec;
+  }
+  Mpi::GlobalAnd(1, &success, comm);
+  if (!success)
+  {
+    Mpi::Warning(comm, "Unable to write partitioned mesh to cache directory \"{}\"!\n",
+                 dir);
+  }
+}
+
 }  // namespace
 
 }  // namespace palace
@@ -153,6 +153,11 @@ mfem::Vector GetSurfaceNormal(const mfem::ParMesh &mesh, bool average = true);
 // the intermediate stages to disk. Returns the imbalance ratio before rebalancing.
 double RebalanceMesh(std::unique_ptr<mfem::ParMesh> &mesh, const IoData &iodata);
 
+// Replicate a parallel mesh across groups of processes given by a split of its
+// communicator, with each group holding a complete copy of the mesh distributed across the
+// processes of the group communicator.
+std::unique_ptr<mfem::ParMesh> ReplicateMesh(const mfem::ParMesh &mesh, MPI_Comm group_comm);
+
 }  // namespace mesh
 
 }  // namespace palace
@@ -3,9 +3,21 @@
 
 #include "meshio.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
+#include <fcntl.h>
 #include <mfem.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "utils/omp.hpp"
 
 #define GMSH_BIN  // Use binary Gmsh format
 
@@ -218,7 +230,7 @@ constexpr const int *ElemNodesNastran[] = {SkipElem, Msh3,     Msh4,     Msh4,
 
 // Get line, strip comments, leading/trailing whitespace. Should not be called if end of
 // file is expected.
-inline std::string GetLineComsol(std::ifstream &input)
+inline std::string GetLineComsol(std::istream &input)
 {
   std::string str;
   std::getline(input, str);
@@ -237,7 +249,7 @@ inline std::string GetLineComsol(std::ifstream &input)
   return str.substr(start, stop - start + 1);
 }
 
-inline std::string GetLineNastran(std::ifstream &input)
+inline std::string GetLineNastran(std::istream &input)
 {
   std::string str;
   std::getline(input, str);
@@ -293,6 +305,152 @@ inline double ConvertDoubleNastran(const std::string &str)
   return d;
 }
 
+// Read-only memory mapping of a mesh file, exposed as a stream buffer so that file headers
+// can be parsed using standard streams while large blocks of data are tokenized in place.
+class MappedFileBuffer : public std::streambuf
+{
+private:
+  char *data;
+  std::size_t size;
+  bool mapped;
+  std::vector<char> buffer;
+
+public:
+  MappedFileBuffer(const std::string &filename) : data(nullptr), size(0), mapped(false)
+  {
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      MFEM_ABORT("Unable to open mesh file \"" << filename << "\"!");
+    }
+    struct stat st;
+    MFEM_VERIFY(fstat(fd, &st) == 0, "Unable to stat mesh file \"" << filename << "\"!");
+    size = static_cast<std::size_t>(st.st_size);
+    if (size > 0)
+    {
+      void *ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr != MAP_FAILED)
+      {
+        madvise(ptr, size, MADV_SEQUENTIAL);
+        data = static_cast<char *>(ptr);
+        mapped = true;
+      }
+      else
+      {
+        // Fall back to reading the entire file into memory.
+        buffer.resize(size);
+        std::size_t offset = 0;
+        while (offset < size)
+        {
+          const auto n = read(fd, buffer.data() + offset, size - offset);
+          MFEM_VERIFY(n > 0, "Unable to read mesh file \"" << filename << "\"!");
+          offset += static_cast<std::size_t>(n);
+        }
+        data = buffer.data();
+      }
+    }
+    close(fd);
+    setg(data, data, data + size);
+  }
+
+  ~MappedFileBuffer() override
+  {
+    if (mapped)
+    {
+      munmap(data, size);
+    }
+  }
+
+  // Access the current read position and the end of the file data, and advance the read
+  // position after data has been consumed directly.
+  const char *Current() const { return gptr(); }
+  const char *End() const { return egptr(); }
+  void Advance(const char *ptr) { setg(eback(), const_cast<char *>(ptr), egptr()); }
+};
+
+// Parse a single numeric token from the given position in the line, advancing the position.
+// Returns false if the line is exhausted or the token is not a valid number.
+template <typename T>
+inline bool ParseToken(const char *&ptr, const char *end, T &value)
+{
+  while (ptr < end && (*ptr == ' ' || *ptr == '\t'))
+  {
+    ptr++;
+  }
+  char token[64];
+  int k = 0;
+  while (ptr < end && k < 63 && *ptr != ' ' && *ptr != '\t' && *ptr != '\r' &&
+         *ptr != '\n' && *ptr != '#')
+  {
+    token[k++] = *ptr++;
+  }
+  if (k == 0)
+  {
+    return false;
+  }
+  token[k] = '\0';
+  char *stop;
+  if constexpr (std::is_integral<T>::value)
+  {
+    value = static_cast<T>(std::strtol(token, &stop, 10));
+  }
+  else
+  {
+    value = std::strtod(token, &stop);
+  }
+  return stop == token + k;
+}
+
+// Tokenize the next n nonempty lines (after stripping comments) of an ASCII COMSOL mesh
+// file, each containing m numeric values, directly from the mapped file data. The line
+// starts are located serially and then the lines are parsed in parallel, calling
+// f(i, values) for each line i. The stream buffer is advanced past the parsed lines.
+template <typename T, typename Functor>
+void ParseLinesComsol(MappedFileBuffer &file, int n, int m, Functor &&f)
+{
+  constexpr int MAX_VALUES = 32;
+  MFEM_VERIFY(m <= MAX_VALUES, "Too many values per line parsing COMSOL mesh file!");
+  std::vector<const char *> lines;
+  lines.reserve(n);
+  const char *ptr = file.Current(), *end = file.End();
+  while (static_cast<int>(lines.size()) < n)
+  {
+    MFEM_VERIFY(ptr < end, "Unexpected end of file parsing COMSOL mesh file!");
+    const char *eol = static_cast<const char *>(std::memchr(ptr, '\n', end - ptr));
+    eol = eol ? eol : end;
+    while (ptr < eol && (*ptr == ' ' || *ptr == '\t' || *ptr == '\r'))
+    {
+      ptr++;
+    }
+    if (ptr < eol && *ptr != '#')
+    {
+      lines.push_back(ptr);
+    }
+    ptr = (eol < end) ? eol + 1 : end;
+  }
+  file.Advance(ptr);
+
+  int num_failed = 0;
+  PalacePragmaOmp(parallel for reduction(+ : num_failed) schedule(static))
+  for (int i = 0; i < n; i++)
+  {
+    std::array<T, MAX_VALUES> values;
+    const char *pos = lines[i];
+    int j = 0;
+    while (j < m && ParseToken(pos, end, values[j]))
+    {
+      j++;
+    }
+    if (j < m)
+    {
+      num_failed++;
+      continue;
+    }
+    f(i, values.data());
+  }
+  MFEM_VERIFY(num_failed == 0, "Invalid numeric data found parsing COMSOL mesh file!");
+}
+
 inline void WriteNode(std::ostream &buffer, const int tag, const double *coord)
 {
 #if defined(GMSH_BIN)
@@ -413,13 +571,174 @@ void WriteGmsh(std::ostream &buffer, const std::vector<double> &node_coords,
   buffer << "$EndElements\n";
 }
 
-}  // namespace
+// Dimension of the reference element for each Gmsh element type.
+inline int ElemDimGmsh(int type)
+{
+  const int lo_type = LOElemTypeGmsh(type);
+  MFEM_VERIFY(lo_type > 1 && lo_type < 8, "Unsupported Gmsh element type " << type << "!");
+  return (lo_type < 4) ? 2 : 3;
+}
 
-namespace mesh
+inline mfem::Geometry::Type ElemGeomGmsh(int type)
 {
+  switch (LOElemTypeGmsh(type))
+  {
+    case 2:
+      return mfem::Geometry::TRIANGLE;
+    case 3:
+      return mfem::Geometry::SQUARE;
+    case 4:
+      return mfem::Geometry::TETRAHEDRON;
+    case 5:
+      return mfem::Geometry::CUBE;
+    case 6:
+      return mfem::Geometry::PRISM;
+    case 7:
+      return mfem::Geometry::PYRAMID;
+  }
+  MFEM_ABORT("Unsupported Gmsh element type " << type << "!");
+  return mfem::Geometry::INVALID;
+}
 
-void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
-                       bool remove_curvature)
+std::unique_ptr<mfem::Mesh>
+BuildMesh(const std::vector<double> &node_coords, const std::vector<int> &node_tags,
+          const std::unordered_map<int, std::vector<int>> &elem_nodes,
+          const bool use_lo_type)
+{
+  constexpr bool generate_edges = true, refine = true, fix_orientation = true;
+  MFEM_VERIFY(!elem_nodes.empty(), "No mesh elements parsed from mesh file!");
+  const int num_nodes = static_cast<int>(node_coords.size()) / 3;
+  MFEM_VERIFY(num_nodes > 0 && node_coords.size() % 3 == 0,
+              "Mesh nodes should always be in 3D space!");
+
+  // Curved meshes require mapping the high-order element nodes to the MFEM ordering for the
+  // mesh nodal grid function, which is left to MFEM's Gmsh reader.
+  if (!use_lo_type && std::any_of(elem_nodes.begin(), elem_nodes.end(),
+                                  [](const auto &data)
+                                  { return LOElemTypeGmsh(data.first) != data.first; }))
+  {
+    std::stringstream fi(std::stringstream::in | std::stringstream::out);
+    fi << std::scientific;
+    fi.precision(std::numeric_limits<double>::max_digits10);
+    WriteGmsh(fi, node_coords, node_tags, elem_nodes, use_lo_type);
+    return std::make_unique<mfem::Mesh>(fi, generate_edges, refine, fix_orientation);
+  }
+
+  // Otherwise, construct the mesh directly from the element vertices. Elements of the
+  // highest dimension are domain elements, those of one dimension lower are boundary
+  // elements, as for MFEM's Gmsh reader. Only nodes which are element vertices are kept.
+  int dim = 0;
+  for (const auto &[elem_type, nodes] : elem_nodes)
+  {
+    dim = std::max(dim, ElemDimGmsh(elem_type));
+  }
+  std::unordered_map<int, int> tag_to_node;
+  if (!node_tags.empty())
+  {
+    MFEM_VERIFY(node_tags.size() == (std::size_t)num_nodes, "Invalid size for node tags!");
+    tag_to_node.reserve(node_tags.size());
+    for (int i = 0; i < num_nodes; i++)
+    {
+      tag_to_node[node_tags[i]] = i;
+    }
+  }
+  auto NodeIndex = [&](int tag)
+  {
+    if (node_tags.empty())
+    {
+      MFEM_VERIFY(tag > 0 && tag <= num_nodes, "Invalid node tag " << tag << "!");
+      return tag - 1;
+    }
+    auto it = tag_to_node.find(tag);
+    MFEM_VERIFY(it != tag_to_node.end(), "Invalid node tag " << tag << "!");
+    return it->second;
+  };
+  std::vector<int> node_to_vertex(num_nodes, -1);
+  int num_elem = 0, num_bdr_elem = 0;
+  for (const auto &[elem_type, nodes] : elem_nodes)
+  {
+    const int elem_dim = ElemDimGmsh(elem_type);
+    if (elem_dim < dim - 1)
+    {
+      continue;
+    }
+    const int &num_elem_nodes = ElemNumNodes[elem_type - 1];
+    const int &num_elem_vert = ElemNumNodes[LOElemTypeGmsh(elem_type) - 1];
+    const int num_elem_type = (int)nodes.size() / (num_elem_nodes + 1);
+    ((elem_dim == dim) ? num_elem : num_bdr_elem) += num_elem_type;
+    for (int i = 0; i < num_elem_type; i++)
+    {
+      for (int j = 0; j < num_elem_vert; j++)
+      {
+        node_to_vertex[NodeIndex(nodes[i * (num_elem_nodes + 1) + 1 + j])] = 0;
+      }
+    }
+  }
+  int num_vert = 0;
+  for (auto &v : node_to_vertex)
+  {
+    if (v == 0)
+    {
+      v = num_vert++;
+    }
+  }
+  MFEM_VERIFY(num_elem > 0, "No domain elements parsed from mesh file!");
+
+  // Nodes are always parsed in 3D, but 2D meshes in the xy-plane have 2D coordinates.
+  int sdim = dim;
+  for (int i = 0; i < num_nodes && sdim < 3; i++)
+  {
+    if (node_to_vertex[i] >= 0 && node_coords[3 * i + 2] != 0.0)
+    {
+      sdim = 3;
+    }
+  }
+  auto mesh = std::make_unique<mfem::Mesh>(dim, num_vert, num_elem, num_bdr_elem, sdim);
+  for (int i = 0; i < num_nodes; i++)
+  {
+    if (node_to_vertex[i] >= 0)
+    {
+      mesh->AddVertex(&node_coords[3 * i]);
+    }
+  }
+  for (const auto &[elem_type, nodes] : elem_nodes)
+  {
+    const int elem_dim = ElemDimGmsh(elem_type);
+    if (elem_dim < dim - 1)
+    {
+      continue;
+    }
+    const auto geom = ElemGeomGmsh(elem_type);
+    const int &num_elem_nodes = ElemNumNodes[elem_type - 1];
+    const int &num_elem_vert = ElemNumNodes[LOElemTypeGmsh(elem_type) - 1];
+    const int num_elem_type = (int)nodes.size() / (num_elem_nodes + 1);
+    std::array<int, 8> vert;
+    for (int i = 0; i < num_elem_type; i++)
+    {
+      for (int j = 0; j < num_elem_vert; j++)
+      {
+        vert[j] = node_to_vertex[NodeIndex(nodes[i * (num_elem_nodes + 1) + 1 + j])];
+      }
+      mfem::Element *el = mesh->NewElement(geom);
+      el->SetVertices(vert.data());
+      el->SetAttribute(nodes[i * (num_elem_nodes + 1)]);  // Geometry tag
+      if (elem_dim == dim)
+      {
+        mesh->AddElement(el);
+      }
+      else
+      {
+        mesh->AddBdrElement(el);
+      }
+    }
+  }
+  mesh->FinalizeTopology();
+  mesh->Finalize(refine, fix_orientation);
+  return mesh;
+}
+
+void ParseMeshComsol(const std::string &filename, std::vector<double> &node_coords,
+                     std::unordered_map<int, std::vector<int>> &elem_nodes)
 {
   // Read a COMSOL format mesh.
   const int comsol_bin = !filename.compare(filename.length() - 7, 7, ".mphbin") ||
@@ -427,11 +746,8 @@ void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
   MFEM_VERIFY(!filename.compare(filename.length() - 7, 7, ".mphtxt") ||
                   !filename.compare(filename.length() - 7, 7, ".MPHTXT") || comsol_bin,
               "Invalid file extension for COMSOL mesh format conversion!");
-  std::ifstream input(filename);
-  if (!input.is_open())
-  {
-    MFEM_ABORT("Unable to open mesh file \"" << filename << "\"!");
-  }
+  MappedFileBuffer file(filename);
+  std::istream input(&file);
 
   // Parse COMSOL header. COMSOL encodes strings as integer-string pairs where the integer
   // is the string length. It also allows for blank lines and other whitespace wherever in
@@ -662,26 +978,20 @@ void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
   }
 
   // Parse mesh nodes.
-  std::vector<double> node_coords;
   {
     // Gmsh nodes are always 3D, so initialize to 0.0 in case z-coordinate isn't set.
     node_coords.resize(3 * num_nodes, 0.0);
     int i = 0;
     if (!comsol_bin)
     {
-      while (i < num_nodes)
-      {
-        auto line = GetLineComsol(input);
-        if (!line.empty())
-        {
-          std::istringstream sline(line);
-          for (int j = 0; j < sdim; j++)
-          {
-            sline >> node_coords[3 * i + j];
-          }
-          i++;
-        }
-      }
+      ParseLinesComsol<double>(file, num_nodes, sdim,
+                               [&](int k, const double *x)
+                               {
+                                 for (int j = 0; j < sdim; j++)
+                                 {
+                                   node_coords[3 * k + j] = x[j];
+                                 }
+                               });
     }
     else
     {
@@ -696,7 +1006,6 @@ void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
   }
 
   // Parse mesh elements. Store for each element of each type: [geometry tag, [node tags]].
-  std::unordered_map<int, std::vector<int>> elem_nodes;
   {
     int num_elem_types = -1;
     if (!comsol_bin)
@@ -765,26 +1074,21 @@ void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
             }
 
             // Parse all element nodes.
-            int i = 0;
-            while (i < num_elem)
-            {
-              line = GetLineComsol(input);
-              if (!line.empty())
-              {
-                if (!skip_type)
+            ParseLinesComsol<int>(
+                file, num_elem, num_elem_nodes,
+                [&](int i, const int *nodes)
                 {
-                  std::istringstream isline(line);
-                  for (int j = 0; j < num_elem_nodes; j++)
+                  if (!skip_type)
                   {
-                    // Permute and reset to 1-based node tags.
-                    const int &p = ElemNodesComsol[elem_type - 1][j];
-                    isline >> (*data)[i * (num_elem_nodes + 1) + 1 + p];
-                    (*data)[i * (num_elem_nodes + 1) + 1 + p] += (1 - nodes_start);
+                    for (int j = 0; j < num_elem_nodes; j++)
+                    {
+                      // Permute and reset to 1-based node tags.
+                      const int &p = ElemNodesComsol[elem_type - 1][j];
+                      (*data)[i * (num_elem_nodes + 1) + 1 + p] =
+                          nodes[j] + (1 - nodes_start);
+                    }
                   }
-                }
-                i++;
-              }
-            }
+                });
           }
           else if (num_elem_geom < 0)
           {
@@ -804,23 +1108,17 @@ void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
             // Parse all element geometry tags (stored at beginning of element nodes). For
             // geometric entites in < 3D, the exported COMSOL tags are 0-based and need
             // correcting to 1-based for Gmsh.
-            int i = 0;
             const int geom_start =
                 (elem_type < 4 || (elem_type > 7 && elem_type < 11)) ? 1 : 0;
-            while (i < num_elem)
-            {
-              line = GetLineComsol(input);
-              if (!line.empty())
-              {
-                if (!skip_type)
-                {
-                  std::istringstream ssline(line);
-                  ssline >> (*data)[i * (num_elem_nodes + 1)];
-                  (*data)[i * (num_elem_nodes + 1)] += geom_start;
-                }
-                i++;
-              }
-            }
+            ParseLinesComsol<int>(file, num_elem, 1,
+                                  [&](int i, const int *geom_tag)
+                                  {
+                                    if (!skip_type)
+                                    {
+                                      (*data)[i * (num_elem_nodes + 1)] =
+                                          geom_tag[0] + geom_start;
+                                    }
+                                  });
 
             // Debug
             // std::cout << "Finished parsing " << num_elem
@@ -908,14 +1206,11 @@ void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
     }
   }
 
-  // Finalize input, write the Gmsh mesh.
-  input.close();
-  std::vector<int> dummy;
-  WriteGmsh(buffer, node_coords, dummy, elem_nodes, remove_curvature);
 }
 
-void ConvertMeshNastran(const std::string &filename, std::ostream &buffer,
-                        bool remove_curvature)
+void ParseMeshNastran(const std::string &filename, std::vector<double> &node_coords,
+                      std::vector<int> &node_tags,
+                      std::unordered_map<int, std::vector<int>> &elem_nodes)
 {
   // Read a Nastran/BDF format mesh.
   MFEM_VERIFY(!filename.compare(filename.length() - 4, 4, ".nas") ||
@@ -923,11 +1218,8 @@ void ConvertMeshNastran(const std::string &filename, std::ostream &buffer,
                   !filename.compare(filename.length() - 4, 4, ".bdf") ||
                   !filename.compare(filename.length() - 4, 4, ".BDF"),
               "Invalid file extension for Nastran mesh format conversion!");
-  std::ifstream input(filename);
-  if (!input.is_open())
-  {
-    MFEM_ABORT("Unable to open mesh file \"" << filename << "\"!");
-  }
+  MappedFileBuffer file(filename);
+  std::istream input(&file);
   const int NASTRAN_CHUNK = 8;  // NASTRAN divides row into 10 columns of 8 spaces
   const int MAX_CHUNK = 9;      // Never read the 10-th chunk
 
@@ -946,9 +1238,6 @@ void ConvertMeshNastran(const std::string &filename, std::ostream &buffer,
 
   // Parse mesh nodes and elements. It is expected that node tags start at 1 and are
   // contiguous. Store for each element of each type: [geometry tag, [node tags]].
-  std::vector<double> node_coords;
-  std::vector<int> node_tags;
-  std::unordered_map<int, std::vector<int>> elem_nodes;
   int elem_type;
   while (true)
   {
@@ -1115,11 +1404,51 @@ void ConvertMeshNastran(const std::string &filename, std::ostream &buffer,
     }
   }
 
-  // Finalize input, write the Gmsh mesh.
-  input.close();
+}
+
+}  // namespace
+
+namespace mesh
+{
+
+void ConvertMeshComsol(const std::string &filename, std::ostream &buffer,
+                       bool remove_curvature)
+{
+  std::vector<double> node_coords;
+  std::unordered_map<int, std::vector<int>> elem_nodes;
+  ParseMeshComsol(filename, node_coords, elem_nodes);
+  WriteGmsh(buffer, node_coords, {}, elem_nodes, remove_curvature);
+}
+
+void ConvertMeshNastran(const std::string &filename, std::ostream &buffer,
+                        bool remove_curvature)
+{
+  std::vector<double> node_coords;
+  std::vector<int> node_tags;
+  std::unordered_map<int, std::vector<int>> elem_nodes;
+  ParseMeshNastran(filename, node_coords, node_tags, elem_nodes);
   WriteGmsh(buffer, node_coords, node_tags, elem_nodes, remove_curvature);
 }
 
+std::unique_ptr<mfem::Mesh> LoadMeshComsol(const std::string &filename,
+                                           bool remove_curvature)
+{
+  std::vector<double> node_coords;
+  std::unordered_map<int, std::vector<int>> elem_nodes;
+  ParseMeshComsol(filename, node_coords, elem_nodes);
+  return BuildMesh(node_coords, {}, elem_nodes, remove_curvature);
+}
+
+std::unique_ptr<mfem::Mesh> LoadMeshNastran(const std::string &filename,
+                                            bool remove_curvature)
+{
+  std::vector<double> node_coords;
+  std::vector<int> node_tags;
+  std::unordered_map<int, std::vector<int>> elem_nodes;
+  ParseMeshNastran(filename, node_coords, node_tags, elem_nodes);
+  return BuildMesh(node_coords, node_tags, elem_nodes, remove_curvature);
+}
+
 }  // namespace mesh
 
 }  // namespace palace
@@ -5,11 +5,32 @@
 #define PALACE_UTILS_MESH_IO_HPP
 
 #include <iostream>
+#include <memory>
 #include <string>
 
+namespace mfem
+{
+
+class Mesh;
+
+}  // namespace mfem
+
 namespace palace::mesh
 {
 
+//
+// Functions for loading COMSOL and Nastran meshes, which are not supported natively by
+// MFEM. The serial mesh is constructed directly from the parsed nodes and elements.
+//
+
+// Load a binary or ASCII COMSOL (.mphbin/.mphtxt) mesh.
+std::unique_ptr<mfem::Mesh> LoadMeshComsol(const std::string &filename,
+                                           bool remove_curvature = false);
+
+// Load an ASCII NASTRAN (.nas/.bdf) mesh.
+std::unique_ptr<mfem::Mesh> LoadMeshNastran(const std::string &filename,
+                                            bool remove_curvature = false);
+
 //
 // Functions for mesh format conversion to Gmsh format, which is supported by MFEM. In both
 // cases, the user should configure the buffer for the desired floating point
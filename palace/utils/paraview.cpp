@@ -0,0 +1,125 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "paraview.hpp"
+
+#include <fstream>
+#include <sstream>
+#include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
+
+namespace palace
+{
+
+void AsyncParaViewDataCollection::BeginSave()
+{
+  MFEM_VERIFY(!pending && !finish_pending,
+              "AsyncParaViewDataCollection::BeginSave called before FinishSave for the "
+              "previous cycle!");
+  MFEM_VERIFY(mesh, "AsyncParaViewDataCollection requires a mesh for output!");
+
+  // Create the directory for this cycle (the only step which requires communication).
+  const std::string col_path = GenerateCollectionPath();
+  const std::string vtu_path = GenerateVTUPath();
+  const std::string dir = col_path + "/" + vtu_path;
+  int err = 0;
+  if (myid == 0)
+  {
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    err = ec ? 1 : 0;
+  }
+  Mpi::Broadcast(1, &err, 0, GetComm());
+  MFEM_VERIFY(!err, "Failed to create ParaView output directory " << dir << "!");
+  vtu_file = dir + "/" + GenerateVTUFileName("proc", myid);
+
+  // The PVTU and PVD file contents only depend on the registered field names and the cycle
+  // metadata, so are generated here to avoid accessing any shared state while writing.
+  if (myid == 0)
+  {
+    std::ostringstream pvtu;
+    WritePVTUHeader(pvtu);
+    pvtu << "<PPointData>\n";
+    auto WriteArray = [&pvtu, this](const std::string &name, int vdim)
+    {
+      pvtu << "<PDataArray type=\"" << GetDataTypeString() << "\" Name=\"" << name
+           << "\" NumberOfComponents=\"" << vdim << "\" format=\"" << GetDataFormatString()
+           << "\" />\n";
+    };
+    for (const auto &[name, gf] : GetFieldMap())
+    {
+      WriteArray(name, gf->VectorDim());
+    }
+    for (const auto &[name, vdim] : coeff_fields)
+    {
+      WriteArray(name, vdim);
+    }
+    pvtu << "</PPointData>\n";
+    pvtu << "<PCellData>\n";
+    pvtu << "\t<PDataArray type=\"Int32\" Name=\"attribute\" NumberOfComponents=\"1\""
+         << " format=\"" << GetDataFormatString() << "\"/>\n";
+    pvtu << "</PCellData>\n";
+    WritePVTUFooter(pvtu, "proc");
+    pvtu_file = dir + "/" + GeneratePVTUFileName("data");
+    pvtu_data = pvtu.str();
+
+    pvd_entries.emplace_back(GetTime(), vtu_path + "/" + GeneratePVTUFileName("data"));
+    std::ostringstream pvd;
+    pvd.precision(precision);
+    pvd << "<?xml version=\"1.0\"?>\n";
+    pvd << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\""
+        << mfem::VTKByteOrder() << "\">\n";
+    pvd << "<Collection>\n";
+    for (const auto &[time, file] : pvd_entries)
+    {
+      pvd << "<DataSet timestep=\"" << time << "\" group=\"\" part=\"0\" file=\"" << file
+          << "\" name=\"" << file.substr(0, file.find('/')) << "\"/>\n";
+    }
+    pvd << "</Collection>\n";
+    pvd << "</VTKFile>\n";
+    pvd_file = col_path + "/" + GeneratePVDFileName();
+    pvd_data = pvd.str();
+  }
+  pending = true;
+}
+
+void AsyncParaViewDataCollection::EndSave()
+{
+  MFEM_VERIFY(pending, "AsyncParaViewDataCollection::EndSave called without BeginSave!");
+  {
+    std::ofstream fo(vtu_file);
+    fo.precision(precision);
+    SaveDataVTU(fo, levels_of_detail);
+  }
+  pending = false;
+  finish_pending = true;
+}
+
+void AsyncParaViewDataCollection::FinishSave()
+{
+  MFEM_VERIFY(!pending, "AsyncParaViewDataCollection::FinishSave called before EndSave!");
+  if (!finish_pending)
+  {
+    return;
+  }
+
+  // The PVTU and PVD files reference the VTU data from all processes, so are only written
+  // once every process has finished writing. The PVD file is written last and atomically,
+  // so that it never references missing data.
+  Mpi::Barrier(GetComm());
+  if (myid == 0)
+  {
+    {
+      std::ofstream fo(pvtu_file);
+      fo << pvtu_data;
+    }
+    {
+      std::ofstream fo(pvd_file + ".tmp");
+      fo << pvd_data;
+    }
+    std::filesystem::rename(pvd_file + ".tmp", pvd_file);
+  }
+  finish_pending = false;
+}
+
+}  // namespace palace
@@ -0,0 +1,87 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_UTILS_PARAVIEW_HPP
+#define PALACE_UTILS_PARAVIEW_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <mfem.hpp>
+
+namespace palace
+{
+
+//
+// A ParaView data collection for which saving is split into three stages: BeginSave, which
+// performs any communication (creating the output directories) and must be called from the
+// main thread on all processes, EndSave, which compresses and writes the data files without
+// any communication and can be called from a background thread, and FinishSave, which
+// writes the PVTU and PVD files once all processes have completed EndSave and must again be
+// called from the main thread on all processes. The mesh and registered fields must not be
+// modified between BeginSave and EndSave.
+//
+class AsyncParaViewDataCollection : public mfem::ParaViewDataCollection
+{
+private:
+  // Levels of refinement for high-order output (not accessible from the base class).
+  int levels_of_detail;
+
+  // Names and number of components of registered coefficient fields, for the PVTU file.
+  std::vector<std::pair<std::string, int>> coeff_fields;
+
+  // Time and relative PVTU file path for each saved cycle, for the PVD file (root only).
+  std::vector<std::pair<double, std::string>> pvd_entries;
+
+  // File paths and contents for the pending save, set by BeginSave.
+  std::string vtu_file, pvtu_file, pvtu_data, pvd_file, pvd_data;
+  bool pending, finish_pending;
+
+public:
+  AsyncParaViewDataCollection(const std::string &name, mfem::Mesh *mesh = nullptr)
+    : mfem::ParaViewDataCollection(name, mesh), levels_of_detail(1), pending(false),
+      finish_pending(false)
+  {
+  }
+
+  void SetLevelsOfDetail(int levels_of_detail_)
+  {
+    levels_of_detail = levels_of_detail_;
+    mfem::ParaViewDataCollection::SetLevelsOfDetail(levels_of_detail_);
+  }
+
+  void RegisterCoeffField(const std::string &name, mfem::Coefficient *coeff)
+  {
+    coeff_fields.emplace_back(name, 1);
+    mfem::ParaViewDataCollection::RegisterCoeffField(name, coeff);
+  }
+
+  void RegisterVCoeffField(const std::string &name, mfem::VectorCoefficient *coeff)
+  {
+    coeff_fields.emplace_back(name, coeff->GetVDim());
+    mfem::ParaViewDataCollection::RegisterVCoeffField(name, coeff);
+  }
+
+  // Create the output directory for the current cycle and prepare the PVTU and PVD file
+  // contents. Collective on the mesh communicator.
+  void BeginSave();
+
+  // Write the VTU data for this process. Does not communicate.
+  void EndSave();
+
+  // Wait for all processes to complete EndSave and write the PVTU and PVD files on the
+  // root. Collective on the mesh communicator, and does nothing if there is no completed save.
+  void FinishSave();
+
+  // Save synchronously.
+  void Save() override
+  {
+    BeginSave();
+    EndSave();
+    FinishSave();
+  }
+};
+
+}  // namespace palace
+
+#endif  // PALACE_UTILS_PARAVIEW_HPP
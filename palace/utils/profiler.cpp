@@ -0,0 +1,290 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+using json = nlohmann::json;
+
+namespace
+{
+
+// Escape a region name for output as a JSON string.
+std::string EscapeJSON(const std::string &str)
+{
+  std::string out;
+  out.reserve(str.size());
+  for (const auto c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out;
+}
+
+}  // namespace
+
+std::string Profiler::Path(int i)
+{
+  return (regions[i].parent < 0) ? regions[i].name
+                                 : Path(regions[i].parent) + "/" + regions[i].name;
+}
+
+void Profiler::Push(const std::string &name)
+{
+  const int parent = stack.back().first;
+  int i = -1;
+  for (const auto child : regions[parent].children)
+  {
+    if (regions[child].name == name)
+    {
+      i = child;
+      break;
+    }
+  }
+  if (i < 0)
+  {
+    i = static_cast<int>(regions.size());
+    regions.push_back({name, parent, {}, {}, 0, 0.0, 0.0});
+    regions[parent].children.push_back(i);
+  }
+  stack.emplace_back(i, Clock::now());
+}
+
+void Profiler::Pop()
+{
+  // The root region is never exited.
+  if (stack.size() <= 1)
+  {
+    return;
+  }
+  const auto end = Clock::now();
+  const auto [i, start] = stack.back();
+  stack.pop_back();
+  regions[i].time += end - start;
+  regions[i].count++;
+  if (trace)
+  {
+    if (events.size() < max_events)
+    {
+      events.push_back({i, start - start_time, end - start_time});
+    }
+    else
+    {
+      dropped_events++;
+    }
+  }
+}
+
+json Profiler::Summary(MPI_Comm comm)
+{
+  // Serialize the local call tree, with the time of the root region measured up to now and
+  // any regions still active included up to now as well.
+  const auto now = Clock::now();
+  const int n = static_cast<int>(regions.size());
+  std::vector<Duration> active(n, Duration::zero());
+  for (const auto &[i, start] : stack)
+  {
+    if (i > 0)
+    {
+      active[i] = now - start;
+    }
+  }
+  std::string loc_paths;
+  std::vector<double> loc_data;
+  loc_data.reserve(4 * n);
+  for (int i = 0; i < n; i++)
+  {
+    loc_paths += Path(i);
+    loc_paths += '\n';
+    loc_data.push_back((i == 0) ? Duration(now - start_time).count()
+                                : (regions[i].time + active[i]).count());
+    loc_data.push_back(std::max(regions[i].count, static_cast<long long>(i == 0)));
+    loc_data.push_back(regions[i].flops);
+    loc_data.push_back(regions[i].bytes);
+  }
+
+  // Gather the call trees of all processes on the root.
+  const int np = Mpi::Size(comm);
+  const bool root = Mpi::Root(comm);
+  int loc_sizes[2] = {static_cast<int>(loc_paths.size()),
+                      static_cast<int>(loc_data.size())};
+  std::vector<int> sizes(root ? 2 * np : 0);
+  MPI_Gather(loc_sizes, 2, MPI_INT, sizes.data(), 2, MPI_INT, 0, comm);
+  std::vector<int> path_counts(root ? np : 0), path_displs(root ? np : 0),
+      data_counts(root ? np : 0), data_displs(root ? np : 0);
+  for (int r = 0; r < (root ? np : 0); r++)
+  {
+    path_counts[r] = sizes[2 * r];
+    data_counts[r] = sizes[2 * r + 1];
+    path_displs[r] = (r == 0) ? 0 : path_displs[r - 1] + path_counts[r - 1];
+    data_displs[r] = (r == 0) ? 0 : data_displs[r - 1] + data_counts[r - 1];
+  }
+  std::string paths(root ? path_displs.back() + path_counts.back() : 0, '\0');
+  std::vector<double> data(root ? data_displs.back() + data_counts.back() : 0);
+  MPI_Gatherv(loc_paths.data(), loc_sizes[0], MPI_CHAR, paths.data(), path_counts.data(),
+              path_displs.data(), MPI_CHAR, 0, comm);
+  MPI_Gatherv(loc_data.data(), loc_sizes[1], MPI_DOUBLE, data.data(), data_counts.data(),
+              data_displs.data(), MPI_DOUBLE, 0, comm);
+  if (!root)
+  {
+    return json();
+  }
+
+  // Merge regions by path across processes. Regions are listed in the order they are first
+  // encountered, so that parents always precede their children.
+  struct Stats
+  {
+    std::string path;
+    int parent;
+    double min, max, sum, count, flops, bytes;
+    int min_rank, max_rank, procs;
+  };
+  std::vector<Stats> stats;
+  std::unordered_map<std::string, int> index;
+  for (int r = 0; r < np; r++)
+  {
+    std::size_t pos = path_displs[r];
+    const double *d = data.data() + data_displs[r];
+    for (int k = 0; k < data_counts[r] / 4; k++, d += 4)
+    {
+      const auto next = paths.find('\n', pos);
+      std::string path = paths.substr(pos, next - pos);
+      pos = next + 1;
+      auto it = index.find(path);
+      if (it == index.end())
+      {
+        const auto sep = path.rfind('/');
+        const int parent = (sep == std::string::npos) ? -1 : index.at(path.substr(0, sep));
+        it = index.emplace(path, static_cast<int>(stats.size())).first;
+        stats.push_back({std::move(path), parent, d[0], d[0], 0.0, 0.0, 0.0, 0.0, r, r, 0});
+      }
+      auto &s = stats[it->second];
+      if (d[0] < s.min)
+      {
+        s.min = d[0];
+        s.min_rank = r;
+      }
+      if (d[0] > s.max)
+      {
+        s.max = d[0];
+        s.max_rank = r;
+      }
+      s.sum += d[0];
+      s.count += d[1];
+      s.flops += d[2];
+      s.bytes += d[3];
+      s.procs++;
+    }
+  }
+
+  // Processes which never entered a region are counted with zero time for the average, so
+  // that the imbalance reflects work which is only performed on a subset of processes.
+  json summary;
+  auto &regions_json = summary["Regions"] = json::array();
+  auto Imbalance = [np](const Stats &s)
+  { return (s.sum > 0.0) ? s.max * np / s.sum : 1.0; };
+  for (const auto &s : stats)
+  {
+    regions_json.push_back({{"Path", s.path},
+                            {"Processes", s.procs},
+                            {"Count", s.count},
+                            {"Min", (s.procs < np) ? 0.0 : s.min},
+                            {"Max", s.max},
+                            {"Avg", s.sum / np},
+                            {"MinRank", s.min_rank},
+                            {"MaxRank", s.max_rank},
+                            {"Imbalance", Imbalance(s)},
+                            {"Flops", s.flops},
+                            {"Bytes", s.bytes}});
+  }
+
+  // Follow the child with the largest maximum time from the root to a leaf. The exclusive
+  // time is the part of the maximum not accounted for by the next region on the path.
+  auto &path_json = summary["CriticalPath"] = json::array();
+  for (int i = 0; i >= 0;)
+  {
+    int next = -1;
+    for (int j = i + 1; j < static_cast<int>(stats.size()); j++)
+    {
+      if (stats[j].parent == i && (next < 0 || stats[j].max > stats[next].max))
+      {
+        next = j;
+      }
+    }
+    const auto &s = stats[i];
+    path_json.push_back({{"Path", s.path},
+                         {"Max", s.max},
+                         {"MaxRank", s.max_rank},
+                         {"Exclusive", s.max - ((next < 0) ? 0.0 : stats[next].max)},
+                         {"Imbalance", Imbalance(s)}});
+    i = next;
+  }
+  return summary;
+}
+
+void Profiler::WriteTrace(MPI_Comm comm, const std::string &path)
+{
+  // Format the local events as complete ("X") events with timestamps in microseconds.
+  const int rank = Mpi::Rank(comm);
+  std::string loc = fmt::format("{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{:d},"
+                                "\"args\":{{\"name\":\"Rank {:d}\"}}}}",
+                                rank, rank);
+  std::vector<std::string> names(regions.size());
+  for (std::size_t i = 0; i < regions.size(); i++)
+  {
+    names[i] = EscapeJSON(regions[i].name);
+  }
+  for (const auto &e : events)
+  {
+    loc += fmt::format(",\n{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+                       "\"pid\":{:d},\"tid\":0}}",
+                       names[e.region], 1.0e6 * e.start.count(),
+                       1.0e6 * (e.end - e.start).count(), rank);
+  }
+  long long dropped = dropped_events;
+  Mpi::GlobalSum(1, &dropped, comm);
+
+  // Stream the events from each process through the root, so that the root only ever holds
+  // the trace for a single process in memory.
+  constexpr int tag = 0;
+  if (rank == 0)
+  {
+    std::ofstream fo(path);
+    if (!fo.is_open())
+    {
+      MFEM_ABORT("Unable to open trace file \"" << path << "\"!");
+    }
+    fo << "{\"traceEvents\":[\n" << loc;
+    std::string buf;
+    for (int r = 1; r < Mpi::Size(comm); r++)
+    {
+      MPI_Status status;
+      int count;
+      MPI_Probe(r, tag, comm, &status);
+      MPI_Get_count(&status, MPI_CHAR, &count);
+      buf.resize(count);
+      MPI_Recv(buf.data(), count, MPI_CHAR, r, tag, comm, MPI_STATUS_IGNORE);
+      fo << ",\n" << buf;
+    }
+    fo << "\n],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"DroppedEvents\":" << dropped
+       << "}}\n";
+  }
+  else
+  {
+    MPI_Send(loc.data(), static_cast<int>(loc.size()), MPI_CHAR, 0, tag, comm);
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,122 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_UTILS_PROFILER_HPP
+#define PALACE_UTILS_PROFILER_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <mpi.h>
+#include <nlohmann/json_fwd.hpp>
+
+namespace palace
+{
+
+//
+// Hierarchical profiler which records dynamically named regions as a call tree. Each node
+// of the tree accumulates the elapsed time, the number of times the region was entered,
+// and optional floating point operation and memory traffic counters. Region data is kept
+// per process and only reduced across processes when a summary or trace is requested. Like
+// BlockTimer, regions should only be entered and exited from the main thread.
+//
+class Profiler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = std::chrono::duration<double>;
+  using TimePoint = typename Clock::time_point;
+
+private:
+  struct Region
+  {
+    std::string name;
+    int parent;
+    std::vector<int> children;
+    Duration time;
+    long long count;
+    double flops, bytes;
+  };
+  struct Event
+  {
+    int region;
+    Duration start, end;
+  };
+
+  inline static const TimePoint start_time = Clock::now();
+  inline static std::vector<Region> regions{{"Total", -1, {}, {}, 0, 0.0, 0.0}};
+  inline static std::vector<std::pair<int, TimePoint>> stack{{0, start_time}};
+
+  // Timeline of completed regions for trace output, when enabled (bounded to limit the
+  // memory used on long runs).
+  inline static bool trace = false;
+  inline static std::vector<Event> events;
+  inline static std::size_t max_events = 1000000, dropped_events = 0;
+
+  // Return the full path of the region in the call tree, with "/" separating the names of
+  // nested regions.
+  static std::string Path(int i);
+
+public:
+  // Enter a region nested in the currently active one.
+  static void Push(const std::string &name);
+
+  // Exit the currently active region.
+  static void Pop();
+
+  // Add to the floating point operation and memory traffic (bytes) counters of the
+  // currently active region.
+  static void AddCounters(double flops, double bytes)
+  {
+    auto &region = regions[stack.back().first];
+    region.flops += flops;
+    region.bytes += bytes;
+  }
+
+  // Enable recording of the region timeline for trace output.
+  static void SetTrace(bool enable, std::size_t max_events_ = 1000000)
+  {
+    trace = enable;
+    max_events = max_events_;
+  }
+  static bool Trace() { return trace; }
+
+  // Reduce the call tree across all processes and return a summary with the minimum,
+  // maximum, and average time of each region, the process with the maximum time and the
+  // ratio of maximum to average (load imbalance), along with the critical path through the
+  // call tree following the region with the largest maximum time at each level. Collective
+  // on the communicator, and the result is only populated on the root.
+  static nlohmann::json Summary(MPI_Comm comm);
+
+  // Write the recorded timeline for all processes to a file in Chrome trace event format,
+  // which can be viewed with Perfetto or chrome://tracing. Each process is written as a
+  // separate trace process using its local clock. Collective on the communicator.
+  static void WriteTrace(MPI_Comm comm, const std::string &path);
+};
+
+// RAII helper for profiling a scoped region.
+class ProfileRegion
+{
+private:
+  bool active;
+
+public:
+  ProfileRegion(const std::string &name, bool active = true) : active(active)
+  {
+    if (active)
+    {
+      Profiler::Push(name);
+    }
+  }
+  ~ProfileRegion()
+  {
+    if (active)
+    {
+      Profiler::Pop();
+    }
+  }
+};
+
+}  // namespace palace
+
+#endif  // PALACE_UTILS_PROFILER_HPP
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include "utils/communication.hpp"
+#include "utils/profiler.hpp"
 
 namespace palace
 {
@@ -163,11 +164,14 @@ public:
   BlockTimer(Index i, bool count = true) : count(count)
   {
     // Start timing when entering the block, interrupting whatever we were timing before.
-    // Take note of what we are now timing.
+    // Take note of what we are now timing. The block is also recorded as a region of the
+    // hierarchical profiler, nested within any enclosing blocks.
     if (count)
     {
       stack.empty() ? timer.Lap() : timer.MarkTime(stack.top(), false);
       stack.push(i);
+      const auto &desc = Timer::descriptions[i];
+      Profiler::Push(desc.substr(desc.find_first_not_of(' ')));
     }
   }
 
@@ -179,6 +183,7 @@ public:
     {
       timer.MarkTime(stack.top());
       stack.pop();
+      Profiler::Pop();
     }
   }
 
@@ -192,6 +197,7 @@ public:
     {
       timer.MarkTime(stack.top());
       stack.pop();
+      Profiler::Pop();
     }
     timer.MarkTime(Timer::TOTAL, timer.TimeFromStart());
 
@@ -1,10 +1,16 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 #include <mfem.hpp>
+#include <nlohmann/json.hpp>
 #include <catch2/catch_session.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
 #include "fem/libceed/ceed.hpp"
 #include "utils/communication.hpp"
 
@@ -16,6 +22,63 @@ int benchmark_order = 4;
 bool benchmark_assemble_q_data = false;
 bool benchmark_no_fa = false;
 bool benchmark_no_mfem_pa = false;
+std::string benchmark_json_file;
+
+namespace
+{
+
+// Results of all benchmarks which have been run, for machine-readable output.
+nlohmann::json benchmark_results = nlohmann::json::array();
+
+// Listener which records the statistics of each benchmark along with the path of sections
+// (starting with the test case name) in which it was run. Times are in seconds.
+class BenchmarkListener : public Catch::EventListenerBase
+{
+private:
+  std::vector<std::string> sections;
+
+public:
+  using Catch::EventListenerBase::EventListenerBase;
+
+  void sectionStarting(const Catch::SectionInfo &info) override
+  {
+    sections.push_back(info.name);
+  }
+
+  void sectionEnded(const Catch::SectionStats &) override { sections.pop_back(); }
+
+  void benchmarkEnded(const Catch::BenchmarkStats<> &stats) override
+  {
+    auto Seconds = [](auto t) { return std::chrono::duration<double>(t).count(); };
+    std::string path;
+    for (const auto &section : sections)
+    {
+      path += (path.empty() ? "" : "/") + section;
+    }
+    benchmark_results.push_back({{"Name", stats.info.name},
+                                 {"Section", path},
+                                 {"Samples", stats.info.samples},
+                                 {"Iterations", stats.info.iterations},
+                                 {"Mean", Seconds(stats.mean.point)},
+                                 {"MeanLowerBound", Seconds(stats.mean.lower_bound)},
+                                 {"MeanUpperBound", Seconds(stats.mean.upper_bound)},
+                                 {"StdDev", Seconds(stats.standardDeviation.point)}});
+  }
+};
+
+}  // namespace
+
+CATCH_REGISTER_LISTENER(BenchmarkListener)
+
+static const char *GetPalaceGitTag()
+{
+#if defined(PALACE_GIT_COMMIT)
+  static const char *commit = PALACE_GIT_COMMIT_ID;
+#else
+  static const char *commit = "UNKNOWN";
+#endif
+  return commit;
+}
 
 int main(int argc, char *argv[])
 {
@@ -44,7 +107,9 @@ int main(int argc, char *argv[])
              Opt(benchmark_no_fa)["--benchmark-skip-full-assembly"](
                  "Skip full assembly tests in benchmarks") |
              Opt(benchmark_no_mfem_pa)["--benchmark-skip-mfem-partial-assembly"](
-                 "Skip MFEM partial assembly tests in benchmarks");
+                 "Skip MFEM partial assembly tests in benchmarks") |
+             Opt(benchmark_json_file, "file")["--benchmark-json"](
+                 "Write benchmark results in JSON format to the given file");
 
   // Now pass the new composite back to Catch2 so it uses that.
   session.cli(cli);
@@ -64,6 +129,31 @@ int main(int argc, char *argv[])
   resource << "libCEED backend: " << ceed::Print();
   Mpi::Print("{}\n", resource.str());
   result = session.run();
+
+  // Write the benchmark results with information identifying the build and configuration,
+  // for tracking performance across commits.
+  if (!benchmark_json_file.empty() && Mpi::Root(Mpi::World()))
+  {
+    nlohmann::json meta;
+    meta["GitCommit"] = GetPalaceGitTag();
+    meta["Device"] = device_str;
+    meta["Backend"] = ceed::Print();
+    meta["Processes"] = Mpi::Size(Mpi::World());
+    meta["RefinementLevels"] = benchmark_ref_levels;
+    meta["Order"] = benchmark_order;
+    meta["Benchmarks"] = benchmark_results;
+    std::ofstream fo(benchmark_json_file);
+    if (!fo.is_open())
+    {
+      std::cerr << "Unable to open benchmark output file \"" << benchmark_json_file
+                << "\"!\n";
+      result = 1;
+    }
+    else
+    {
+      fo << meta.dump(2) << '\n';
+    }
+  }
   ceed::Finalize();
 
   return result;
@@ -0,0 +1,313 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <complex>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark_all.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include "fem/bilinearform.hpp"
+#include "fem/errorindicator.hpp"
+#include "fem/fespace.hpp"
+#include "fem/integrator.hpp"
+#include "fem/mesh.hpp"
+#include "linalg/amg.hpp"
+#include "linalg/chebyshev.hpp"
+#include "linalg/errorestimator.hpp"
+#include "linalg/gmg.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/orthog.hpp"
+#include "linalg/rap.hpp"
+#include "linalg/solver.hpp"
+#include "linalg/vector.hpp"
+#include "models/laplaceoperator.hpp"
+#include "utils/communication.hpp"
+#include "utils/iodata.hpp"
+
+extern int benchmark_ref_levels;
+extern int benchmark_order;
+
+namespace palace
+{
+
+namespace
+{
+
+auto Initialize(MPI_Comm comm, const std::string &input, int ref_levels)
+{
+  // Load the mesh.
+  mfem::Mesh smesh(input, 1, 1);
+  smesh.EnsureNodes();
+
+  // Construct the parallel mesh.
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  auto pmesh = std::make_unique<mfem::ParMesh>(comm, smesh);
+  for (int l = 0; l < ref_levels; l++)
+  {
+    pmesh->UniformRefinement();
+  }
+  std::vector<std::unique_ptr<Mesh>> mesh;
+  mesh.push_back(std::make_unique<Mesh>(std::move(pmesh)));
+  return mesh;
+}
+
+// Configure an electrostatic problem on the mesh with all boundaries grounded, using the
+// default linear solver and error estimator options. IoData can only be constructed from a
+// configuration file, so the configuration is written to a temporary file for each process.
+IoData ConfigureProblem(MPI_Comm comm, const std::string &input, const mfem::ParMesh &mesh,
+                        int order)
+{
+  std::vector<int> attr(mesh.attributes.begin(), mesh.attributes.end());
+  std::vector<int> bdr_attr(mesh.bdr_attributes.begin(), mesh.bdr_attributes.end());
+  const auto path = std::filesystem::temp_directory_path() /
+                    fmt::format("palace-benchmark-{:d}.json", Mpi::Rank(comm));
+  {
+    std::ofstream fo(path);
+    fo << fmt::format("{{\"Problem\": {{\"Type\": \"Electrostatic\"}},\n"
+                      " \"Model\": {{\"Mesh\": \"{}\"}},\n"
+                      " \"Domains\": {{\"Materials\": [{{\"Attributes\": [{}]}}]}},\n"
+                      " \"Boundaries\": {{\"Ground\": {{\"Attributes\": [{}]}}}},\n"
+                      " \"Solver\": {{\"Order\": {:d}}}}}\n",
+                      input, fmt::join(attr, ", "), fmt::join(bdr_attr, ", "), order);
+  }
+  IoData iodata(path.c_str(), false);
+  std::filesystem::remove(path);
+  return iodata;
+}
+
+// Restore the global assembly and quadrature settings modified by IoData on destruction, so
+// that the solver benchmarks do not affect other tests.
+struct AssemblySettingsGuard
+{
+  const int pa_order_threshold = BilinearForm::pa_order_threshold;
+  const int p_trial = fem::DefaultIntegrationOrder::p_trial;
+  const bool q_order_jac = fem::DefaultIntegrationOrder::q_order_jac;
+  const int q_order_extra_pk = fem::DefaultIntegrationOrder::q_order_extra_pk;
+  const int q_order_extra_qk = fem::DefaultIntegrationOrder::q_order_extra_qk;
+  ~AssemblySettingsGuard()
+  {
+    BilinearForm::pa_order_threshold = pa_order_threshold;
+    fem::DefaultIntegrationOrder::p_trial = p_trial;
+    fem::DefaultIntegrationOrder::q_order_jac = q_order_jac;
+    fem::DefaultIntegrationOrder::q_order_extra_pk = q_order_extra_pk;
+    fem::DefaultIntegrationOrder::q_order_extra_qk = q_order_extra_qk;
+  }
+};
+
+void RunSolverBenchmarks(MPI_Comm comm, const std::string &input, int ref_levels, int order)
+{
+  // Load the mesh and set up the problem.
+  AssemblySettingsGuard guard;
+  auto mesh = Initialize(comm, input, ref_levels);
+  auto iodata = ConfigureProblem(comm, input, mesh.back()->Get(), order);
+  LaplaceOperator laplaceop(iodata, mesh);
+  auto K = laplaceop.GetStiffnessMatrix();
+  const auto &K_mg = dynamic_cast<const MultigridOperator &>(*K);
+  const auto &A = dynamic_cast<const ParOperator &>(K_mg.GetFinestOperator());
+  const auto &h1_fespaces = laplaceop.GetH1Spaces();
+  const auto &h1_fespace = laplaceop.GetH1Space();
+
+  // Run the benchmarks.
+  std::string section =
+      "Mesh: " + input + "\n" + "Refinement levels: " + std::to_string(ref_levels) + "\n" +
+      "Order: " + std::to_string(order) + "\n";
+  INFO(section);
+  if (Mpi::Root(comm))
+  {
+    auto pos = input.find_last_of('/');
+    WARN("benchmark input mesh: " << input.substr(pos + 1) << "\n");
+  }
+
+  Vector x(A.Width()), y(A.Height());
+  ComplexVector xc(A.Width()), yc(A.Height());
+  x.UseDevice(true);
+  y.UseDevice(true);
+  xc.UseDevice(true);
+  yc.UseDevice(true);
+  linalg::SetRandom(comm, x);
+  linalg::SetRandom(comm, xc);
+
+  // Operator application including the prolongation from true dofs and restriction back,
+  // and the transfer between multigrid levels.
+  SECTION("Operator Benchmark")
+  {
+    BENCHMARK("Mult (ParOperator)")
+    {
+      A.Mult(x, y);
+      return y.Size();
+    };
+    if (h1_fespaces.GetNumLevels() > 1)
+    {
+      const auto l = h1_fespaces.GetNumLevels() - 2;
+      const auto &P = h1_fespaces.GetProlongationAtLevel(l);
+      Vector xp(P.Width()), yp(P.Height());
+      xp.UseDevice(true);
+      yp.UseDevice(true);
+      linalg::SetRandom(comm, xp);
+      linalg::SetRandom(comm, yp);
+      BENCHMARK("Mult (Prolongation)")
+      {
+        P.Mult(xp, yp);
+        return yp.Size();
+      };
+      BENCHMARK("MultTranspose (Prolongation)")
+      {
+        P.MultTranspose(yp, xp);
+        return xp.Size();
+      };
+    }
+  }
+
+  // Full assembly of the local operator and the parallel Galerkin product Pᵀ A P.
+  SECTION("Assembly Benchmark")
+  {
+    constexpr bool skip_zeros = false;
+    auto AssembleLocal = [&]()
+    {
+      BilinearForm k(h1_fespace);
+      k.AddDomainIntegrator<DiffusionIntegrator>();
+      return k.FullAssemble(skip_zeros);
+    };
+    BENCHMARK("Full Assemble (libCEED)")
+    {
+      auto mat = AssembleLocal();
+      return mat->NNZ();
+    };
+    BENCHMARK("Full Assemble + RAP")
+    {
+      ParOperator op(AssembleLocal(), h1_fespace);
+      return op.ParallelAssemble(skip_zeros).NNZ();
+    };
+  }
+
+  // Geometric multigrid and smoother application.
+  SECTION("Multigrid Benchmark")
+  {
+    if (h1_fespaces.GetNumLevels() > 1)
+    {
+      auto amg = std::make_unique<MfemWrapperSolver<Operator>>(
+          std::make_unique<BoomerAmgSolver>(iodata, true, 0));
+      GeometricMultigridSolver<Operator> gmg(comm, iodata, std::move(amg),
+                                             h1_fespaces.GetProlongationOperators());
+      gmg.SetOperator(*K);
+      BENCHMARK("V-Cycle (GeometricMultigridSolver)")
+      {
+        gmg.Mult(x, y);
+        return y.Size();
+      };
+    }
+    ChebyshevSmoother<Operator> cheby(comm, iodata.solver.linear.mg_smooth_it,
+                                      iodata.solver.linear.mg_smooth_order,
+                                      iodata.solver.linear.mg_smooth_sf_max);
+    cheby.SetOperator(A);
+    BENCHMARK("Mult (ChebyshevSmoother)")
+    {
+      cheby.Mult(x, y);
+      return y.Size();
+    };
+  }
+
+  // Orthogonalization of a vector against a block of basis vectors, as in GMRES or the
+  // PROM basis construction.
+  SECTION("Orthogonalization Benchmark")
+  {
+    constexpr int m = 20;
+    std::vector<ComplexVector> V(m);
+    for (int j = 0; j < m; j++)
+    {
+      V[j].SetSize(A.Height());
+      V[j].UseDevice(true);
+      linalg::SetRandom(comm, V[j], j + 1);
+      linalg::Normalize(comm, V[j]);
+    }
+    std::vector<std::complex<double>> H(m);
+    BENCHMARK("Orthogonalize (MGS)")
+    {
+      yc = xc;
+      linalg::OrthogonalizeColumnMGS(comm, V, yc, H.data(), m);
+      return yc.Size();
+    };
+    BENCHMARK("Orthogonalize (CGS)")
+    {
+      yc = xc;
+      linalg::OrthogonalizeColumnCGS(comm, V, yc, H.data(), m, false);
+      return yc.Size();
+    };
+    BENCHMARK("Orthogonalize (CGS2)")
+    {
+      yc = xc;
+      linalg::OrthogonalizeColumnCGS(comm, V, yc, H.data(), m, true);
+      return yc.Size();
+    };
+  }
+
+  // Vector operations, for complex-valued vectors.
+  SECTION("ComplexVector Benchmark")
+  {
+    ComplexVector zc(A.Height());
+    zc.UseDevice(true);
+    linalg::SetRandom(comm, yc);
+    linalg::SetRandom(comm, zc);
+    const std::complex<double> alpha(0.5, 0.25), beta(-0.25, 0.5), gamma(1.0, 0.0);
+    BENCHMARK("Dot (ComplexVector)")
+    {
+      return linalg::Dot(comm, xc, yc);
+    };
+    BENCHMARK("Norml2 (ComplexVector)")
+    {
+      return linalg::Norml2(comm, xc);
+    };
+    BENCHMARK("AXPY (ComplexVector)")
+    {
+      linalg::AXPY(alpha, xc, yc);
+      return yc.Size();
+    };
+    BENCHMARK("AXPBY (ComplexVector)")
+    {
+      linalg::AXPBY(alpha, xc, beta, yc);
+      return yc.Size();
+    };
+    BENCHMARK("AXPBYPCZ (ComplexVector)")
+    {
+      linalg::AXPBYPCZ(alpha, xc, beta, yc, gamma, zc);
+      return zc.Size();
+    };
+  }
+
+  // Error estimation, including the flux projection solve.
+  SECTION("Error Estimator Benchmark")
+  {
+    GradFluxErrorEstimator estimator(
+        laplaceop.GetMaterialOp(), laplaceop.GetH1Space(), laplaceop.GetRTSpaces(),
+        iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
+        iodata.solver.linear.estimator_mg);
+    BENCHMARK("AddErrorIndicator (GradFluxErrorEstimator)")
+    {
+      ErrorIndicator indicator;
+      estimator.AddErrorIndicator(x, indicator);
+      return indicator.Local().Size();
+    };
+  }
+
+  // Wait before returning.
+  Mpi::Barrier(comm);
+}
+
+}  // namespace
+
+TEST_CASE("3D Solver Benchmarks", "[Solver][Benchmark]")
+{
+  auto mesh = GENERATE("fichera-hex.mesh", "fichera-tet.mesh");
+  DYNAMIC_SECTION(mesh)
+  {
+    RunSolverBenchmarks(MPI_COMM_WORLD, std::string(PALACE_TEST_MESH_DIR "/") + mesh,
+                        benchmark_ref_levels, benchmark_order);
+  }
+}
+
+}  // namespace palace
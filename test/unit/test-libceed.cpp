@@ -1,9 +1,15 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+#include <array>
+#include <complex>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 #include <mfem.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark_all.hpp>
@@ -13,8 +19,13 @@
 #include "fem/integrator.hpp"
 #include "fem/mesh.hpp"
 #include "linalg/hypre.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/rap.hpp"
+#include "linalg/vector.hpp"
 #include "models/materialoperator.hpp"
+#include "models/spaceoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/iodata.hpp"
 
 extern int benchmark_ref_levels;
 extern int benchmark_order;
@@ -1404,6 +1415,306 @@ void RunCeedBenchmarks(MPI_Comm comm, const std::string &input, int ref_levels,
   Mpi::Barrier(comm);
 }
 
+// Configure a driven problem on the mesh with lossy dielectric and conducting materials,
+// and impedance boundaries, so that the stiffness, damping, and mass matrices all have
+// domain and boundary contributions and the mass matrix is complex-valued. IoData can only
+// be constructed from a configuration file, so the configuration is written to a temporary
+// file for each process.
+IoData ConfigureProblem(MPI_Comm comm, const std::string &input, const mfem::ParMesh &mesh,
+                        int order)
+{
+  std::vector<int> attr(mesh.attributes.begin(), mesh.attributes.end());
+  std::vector<int> bdr_attr(mesh.bdr_attributes.begin(), mesh.bdr_attributes.end());
+  const auto path = std::filesystem::temp_directory_path() /
+                    fmt::format("palace-libceed-{:d}.json", Mpi::Rank(comm));
+  {
+    std::ofstream fo(path);
+    fo << fmt::format(
+        "{{\"Problem\": {{\"Type\": \"Driven\"}},\n"
+        " \"Model\": {{\"Mesh\": \"{}\"}},\n"
+        " \"Domains\": {{\"Materials\": [{{\"Attributes\": [{}], \"Permittivity\": 2.0,\n"
+        "                                \"LossTan\": 0.02, \"Conductivity\": 1.0}}]}},\n"
+        " \"Boundaries\": {{\"Impedance\": [{{\"Attributes\": [{}], \"Rs\": 50.0,\n"
+        "                                  \"Ls\": 1.0e-9, \"Cs\": 1.0e-12}}]}},\n"
+        " \"Solver\": {{\"Order\": {:d}, \"PartialAssemblyOrder\": 1,\n"
+        "             \"Driven\": {{\"MinFreq\": 1.0, \"MaxFreq\": 2.0,\n"
+        "                         \"FreqStep\": 1.0}}}}}}\n",
+        input, fmt::join(attr, ", "), fmt::join(bdr_attr, ", "), order);
+  }
+  IoData iodata(path.c_str(), false);
+  std::filesystem::remove(path);
+  return iodata;
+}
+
+// Restore the global assembly and quadrature settings modified by IoData on destruction, so
+// that the system matrix tests do not affect other tests.
+struct AssemblySettingsGuard
+{
+  const int pa_order_threshold = BilinearForm::pa_order_threshold;
+  const int p_trial = fem::DefaultIntegrationOrder::p_trial;
+  const bool q_order_jac = fem::DefaultIntegrationOrder::q_order_jac;
+  const int q_order_extra_pk = fem::DefaultIntegrationOrder::q_order_extra_pk;
+  const int q_order_extra_qk = fem::DefaultIntegrationOrder::q_order_extra_qk;
+  ~AssemblySettingsGuard()
+  {
+    BilinearForm::pa_order_threshold = pa_order_threshold;
+    fem::DefaultIntegrationOrder::p_trial = p_trial;
+    fem::DefaultIntegrationOrder::q_order_jac = q_order_jac;
+    fem::DefaultIntegrationOrder::q_order_extra_pk = q_order_extra_pk;
+    fem::DefaultIntegrationOrder::q_order_extra_qk = q_order_extra_qk;
+  }
+};
+
+void TestComplexOperatorMult(MPI_Comm comm, const ComplexOperator &op_test,
+                             const ComplexOperator &op_ref)
+{
+  ComplexVector x(op_ref.Width()), y_ref(op_ref.Height()), y_test(op_ref.Height());
+  x.UseDevice(true);
+  y_ref.UseDevice(true);
+  y_test.UseDevice(true);
+  linalg::SetRandom(comm, x);
+
+  op_ref.Mult(x, y_ref);
+  op_test.Mult(x, y_test);
+
+  y_test.AXPY(-1.0, y_ref);
+
+  const double norm_ref = linalg::Norml2(comm, y_ref);
+  const double norm_diff = linalg::Norml2(comm, y_test);
+  REQUIRE(norm_ref > 0.0);
+  REQUIRE(norm_diff * norm_diff < 1.0e-12 * std::max(norm_ref * norm_ref, 1.0));
+}
+
+void TestParOperatorFullAssemble(mfem::HypreParMatrix &mat_test,
+                                 mfem::HypreParMatrix &mat_ref)
+{
+  // Compare the local rows of the assembled matrices, with global column indices.
+  mfem::SparseMatrix mat_test_sp, mat_ref_sp;
+  mat_test.MergeDiagAndOffd(mat_test_sp);
+  mat_ref.MergeDiagAndOffd(mat_ref_sp);
+  TestCeedOperatorFullAssemble(mat_test_sp, mat_ref_sp);
+}
+
+// Add a * A to the assembled parallel matrix B (B is allocated if empty).
+void AddParallelAssemble(double a, const Operator *A,
+                         std::unique_ptr<mfem::HypreParMatrix> &B)
+{
+  if (!A || a == 0.0)
+  {
+    return;
+  }
+  auto &A_mat = dynamic_cast<const ParOperator &>(*A).ParallelAssemble();
+  B.reset(B ? mfem::Add(1.0, *B, a, A_mat) : mfem::Add(a, A_mat, 0.0, A_mat));
+}
+
+void RunSystemMatrixTests(MPI_Comm comm, const std::string &input, int order)
+{
+  // Load the mesh and set up the problem, with and without the fused system matrix.
+  AssemblySettingsGuard guard;
+  std::vector<std::unique_ptr<Mesh>> mesh;
+  mesh.push_back(std::make_unique<Mesh>(Initialize(comm, input, 0, false).Get()));
+  auto iodata = ConfigureProblem(comm, input, mesh.back()->Get(), order);
+  iodata.solver.fused_system_mat = true;
+  SpaceOperator spaceop_test(iodata, mesh);
+  iodata.solver.fused_system_mat = false;
+  SpaceOperator spaceop_ref(iodata, mesh);
+
+  // Run the tests.
+  std::string section = "Mesh: " + input + "\n" + "Order: " + std::to_string(order) + "\n";
+  INFO(section);
+
+  const double omega = 2.0;
+  SECTION("Complex System Matrix")
+  {
+    using namespace std::complex_literals;
+    auto K_test = spaceop_test.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    auto C_test = spaceop_test.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    auto M_test = spaceop_test.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    auto K_ref = spaceop_ref.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    auto C_ref = spaceop_ref.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    auto M_ref = spaceop_ref.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    REQUIRE((K_ref && C_ref && M_ref && M_ref->Imag()));
+
+    // Driven system matrix K + iω C - ω² M, and a case with mixed real and imaginary parts
+    // for each of the coefficients.
+    const std::vector<std::array<std::complex<double>, 3>> coeffs = {
+        {1.0, 1i * omega, -omega * omega},
+        {1.0 + 0.5i, 0.25 + 1i * omega, -omega * omega + 0.1i}};
+    for (const auto &[a0, a1, a2] : coeffs)
+    {
+      INFO("Coefficients: " << a0 << ", " << a1 << ", " << a2 << "\n");
+      auto A_test = spaceop_test.GetSystemMatrix(a0, a1, a2, K_test.get(), C_test.get(),
+                                                 M_test.get());
+      auto A_ref =
+          spaceop_ref.GetSystemMatrix(a0, a1, a2, K_ref.get(), C_ref.get(), M_ref.get());
+
+      // Test operator application against the sum of operators.
+      TestComplexOperatorMult(comm, *A_test, *A_ref);
+
+      // Test full assembly against the sum of the assembled real and imaginary parts,
+      // (ar + i ai) (Ar + i Ai) = (ar Ar - ai Ai) + i (ai Ar + ar Ai).
+      std::unique_ptr<mfem::HypreParMatrix> Ar_ref, Ai_ref;
+      for (const auto &[a, A] : {std::make_pair(a0, K_ref.get()),
+                                 std::make_pair(a1, C_ref.get()),
+                                 std::make_pair(a2, M_ref.get())})
+      {
+        AddParallelAssemble(a.real(), A->Real(), Ar_ref);
+        AddParallelAssemble(-a.imag(), A->Imag(), Ar_ref);
+        AddParallelAssemble(a.imag(), A->Real(), Ai_ref);
+        AddParallelAssemble(a.real(), A->Imag(), Ai_ref);
+      }
+      REQUIRE((A_test->Real() && A_test->Imag()));
+      TestParOperatorFullAssemble(
+          dynamic_cast<const ParOperator &>(*A_test->Real()).ParallelAssemble(), *Ar_ref);
+      TestParOperatorFullAssemble(
+          dynamic_cast<const ParOperator &>(*A_test->Imag()).ParallelAssemble(), *Ai_ref);
+    }
+  }
+  SECTION("Real System Matrix")
+  {
+    auto K_test = spaceop_test.GetStiffnessMatrix<Operator>(Operator::DIAG_ZERO);
+    auto C_test = spaceop_test.GetDampingMatrix<Operator>(Operator::DIAG_ZERO);
+    auto M_test = spaceop_test.GetMassMatrix<Operator>(Operator::DIAG_ZERO);
+    auto K_ref = spaceop_ref.GetStiffnessMatrix<Operator>(Operator::DIAG_ZERO);
+    auto C_ref = spaceop_ref.GetDampingMatrix<Operator>(Operator::DIAG_ZERO);
+    auto M_ref = spaceop_ref.GetMassMatrix<Operator>(Operator::DIAG_ZERO);
+    REQUIRE((K_ref && C_ref && M_ref));
+
+    const double a0 = 1.0, a1 = omega, a2 = -omega * omega;
+    auto A_test = spaceop_test.GetSystemMatrix(a0, a1, a2, K_test.get(), C_test.get(),
+                                               M_test.get());
+    auto A_ref =
+        spaceop_ref.GetSystemMatrix(a0, a1, a2, K_ref.get(), C_ref.get(), M_ref.get());
+    TestCeedOperatorMult(*A_test, *A_ref, false);
+
+    std::unique_ptr<mfem::HypreParMatrix> A_ref_mat;
+    AddParallelAssemble(a0, K_ref.get(), A_ref_mat);
+    AddParallelAssemble(a1, C_ref.get(), A_ref_mat);
+    AddParallelAssemble(a2, M_ref.get(), A_ref_mat);
+    TestParOperatorFullAssemble(dynamic_cast<ParOperator &>(*A_test).ParallelAssemble(),
+                                *A_ref_mat);
+  }
+}
+
+void RunCeedGeometryTests(MPI_Comm comm, const std::string &input, int order)
+{
+  // Load the mesh. For straight-sided simplex elements, the geometry factor data is stored
+  // once per element. The reference mesh has the same geometry with second-order nodes, so
+  // the data is stored at each quadrature point.
+  auto mesh = Initialize(comm, input, 0, false);
+  Mesh mesh_ref(mesh.Get());
+  mesh_ref.Get().SetCurvature(2);
+  mesh_ref.ResetCeedObjects();
+  const int dim = mesh.Dimension();
+
+  // Use the same quadrature rule for both meshes (no dependence on the Jacobian order).
+  fem::DefaultIntegrationOrder::p_trial = order;
+  fem::DefaultIntegrationOrder::q_order_jac = false;
+  fem::DefaultIntegrationOrder::q_order_extra_pk = 0;
+  fem::DefaultIntegrationOrder::q_order_extra_qk = 0;
+
+  // Run the tests.
+  std::string section = "Mesh: " + input + "\n" + "Order: " + std::to_string(order) + "\n";
+  INFO(section);
+
+  // Initialize coefficients.
+  auto Q = BuildCoefficient(mesh, false, CoeffType::Scalar);
+  auto MQ = BuildCoefficient(mesh, false, CoeffType::Matrix);
+  auto Qb = BuildCoefficient(mesh, true, CoeffType::Scalar);
+
+  auto TestGeometry = [](const BilinearForm &a_test, const BilinearForm &a_ref)
+  {
+    constexpr bool skip_zeros = false;
+    auto op_test = a_test.PartialAssemble();
+    auto op_ref = a_ref.PartialAssemble();
+    TestCeedOperatorMult(*op_test, *op_ref, false);
+    auto mat_test = BilinearForm::FullAssemble(*op_test, skip_zeros);
+    auto mat_ref = BilinearForm::FullAssemble(*op_ref, skip_zeros);
+    TestCeedOperatorFullAssemble(*mat_test, *mat_ref);
+  };
+  SECTION("H1 Diffusion + Mass Integrator")
+  {
+    mfem::H1_FECollection h1_fec(order, dim);
+    FiniteElementSpace h1_fespace(mesh, &h1_fec), h1_fespace_ref(mesh_ref, &h1_fec);
+    BilinearForm a_test(h1_fespace), a_ref(h1_fespace_ref);
+    a_test.AddDomainIntegrator<DiffusionMassIntegrator>(MQ, Q);
+    a_test.AddBoundaryIntegrator<MassIntegrator>(Qb);
+    a_ref.AddDomainIntegrator<DiffusionMassIntegrator>(MQ, Q);
+    a_ref.AddBoundaryIntegrator<MassIntegrator>(Qb);
+    TestGeometry(a_test, a_ref);
+  }
+  SECTION("ND Curl-Curl + Mass Integrator")
+  {
+    mfem::ND_FECollection nd_fec(order, dim);
+    FiniteElementSpace nd_fespace(mesh, &nd_fec), nd_fespace_ref(mesh_ref, &nd_fec);
+    BilinearForm a_test(nd_fespace), a_ref(nd_fespace_ref);
+    a_test.AddDomainIntegrator<CurlCurlMassIntegrator>(Q, MQ);
+    a_test.AddBoundaryIntegrator<VectorFEMassIntegrator>(Qb);
+    a_ref.AddDomainIntegrator<CurlCurlMassIntegrator>(Q, MQ);
+    a_ref.AddBoundaryIntegrator<VectorFEMassIntegrator>(Qb);
+    TestGeometry(a_test, a_ref);
+  }
+}
+
+void RunCeedAssemblyReuseTests(MPI_Comm comm, const std::string &input, int order)
+{
+  // Load the mesh.
+  auto mesh = Initialize(comm, input, 0, false);
+  const int dim = mesh.Dimension();
+
+  // Match MFEM's default integration orders.
+  fem::DefaultIntegrationOrder::p_trial = order;
+  fem::DefaultIntegrationOrder::q_order_jac = true;
+  fem::DefaultIntegrationOrder::q_order_extra_pk = 0;
+  fem::DefaultIntegrationOrder::q_order_extra_qk = 0;
+
+  // Run the tests.
+  std::string section = "Mesh: " + input + "\n" + "Order: " + std::to_string(order) + "\n";
+  INFO(section);
+
+  // Initialize coefficients.
+  auto Q = BuildCoefficient(mesh, false, CoeffType::Scalar);
+  auto MQ = BuildCoefficient(mesh, false, CoeffType::Matrix);
+  auto Qb = BuildCoefficient(mesh, true, CoeffType::Scalar);
+
+  mfem::ND_FECollection nd_fec(order, dim);
+  FiniteElementSpace nd_fespace(mesh, &nd_fec);
+  auto NumPlans = [&nd_fespace]()
+  {
+    std::size_t num_plans = 0;
+    for (const auto &[ceed, plans] : nd_fespace.GetCeedAssemblyPlans())
+    {
+      num_plans += plans.size();
+    }
+    return num_plans;
+  };
+
+  // The first assembly computes and caches the sparsity pattern on the space, and the
+  // second one with different coefficients for the same integrators reuses it. Both are
+  // compared to assembly without the cache.
+  constexpr bool skip_zeros = false;
+  REQUIRE(NumPlans() == 0);
+  std::size_t num_plans = 0;
+  for (auto *f : {&MQ, &Q})
+  {
+    BilinearForm a(nd_fespace);
+    a.AddDomainIntegrator<CurlCurlMassIntegrator>(Q, *f);
+    a.AddBoundaryIntegrator<VectorFEMassIntegrator>(Qb);
+    auto mat_test = a.FullAssemble(skip_zeros);
+    auto mat_ref = BilinearForm::FullAssemble(*a.PartialAssemble(), skip_zeros, false);
+    TestCeedOperatorFullAssemble(*mat_test, *mat_ref);
+    if (num_plans == 0)
+    {
+      num_plans = NumPlans();
+      REQUIRE(num_plans > 0);
+    }
+    else
+    {
+      REQUIRE(NumPlans() == num_plans);
+    }
+  }
+}
+
 }  // namespace
 
 TEST_CASE("2D libCEED Operators", "[libCEED]")
@@ -1449,4 +1760,33 @@ TEST_CASE("3D libCEED Benchmarks", "[libCEED][Benchmark]")
                     benchmark_ref_levels, false, benchmark_order);
 }
 
+TEST_CASE("3D libCEED System Matrix", "[libCEED][SpaceOperator]")
+{
+  auto mesh = GENERATE("fichera-hex.mesh", "fichera-tet.mesh", "fichera-mixed-p2.mesh");
+  auto order = GENERATE(1, 2);
+  RunSystemMatrixTests(MPI_COMM_WORLD, std::string(PALACE_TEST_MESH_DIR "/") + mesh, order);
+}
+
+TEST_CASE("2D libCEED Affine Geometry", "[libCEED]")
+{
+  auto order = GENERATE(1, 2, 3);
+  RunCeedGeometryTests(MPI_COMM_WORLD,
+                       std::string(PALACE_TEST_MESH_DIR "/") + "star-tri.mesh", order);
+}
+
+TEST_CASE("3D libCEED Affine Geometry", "[libCEED]")
+{
+  auto order = GENERATE(1, 2, 3);
+  RunCeedGeometryTests(MPI_COMM_WORLD,
+                       std::string(PALACE_TEST_MESH_DIR "/") + "fichera-tet.mesh", order);
+}
+
+TEST_CASE("3D libCEED Assembly Reuse", "[libCEED]")
+{
+  auto mesh = GENERATE("fichera-hex.mesh", "fichera-tet.mesh", "fichera-mixed-p2.mesh");
+  auto order = GENERATE(1, 2);
+  RunCeedAssemblyReuseTests(MPI_COMM_WORLD, std::string(PALACE_TEST_MESH_DIR "/") + mesh,
+                            order);
+}
+
 }  // namespace palace